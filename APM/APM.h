@@ -1,9 +1,18 @@
-﻿#pragma once
-
-#include <iostream>
-
-#include "components/Binary_Register.h"
-#include "components/numerical_types/Whole_Number.h"
-#include "components/numerical_types/Integer.h"
-#include "components/numerical_types/Rational.h"
-#include "components/numerical_types/Decimal.h"
\ No newline at end of file
+﻿#pragma once
+
+#include <iostream>
+
+#include "components/Binary_Register.h"
+#include "components/Instrument.h"
+#include "components/Thread_Pool.h"
+#include "components/Mapped_File.h"
+#include "components/numerical_types/Whole_Number.h"
+#include "components/numerical_types/Divisor.h"
+#include "components/numerical_types/Power_Cache.h"
+#include "components/numerical_types/Integer.h"
+#include "components/numerical_types/Rational.h"
+#include "components/numerical_types/Decimal.h"
+#include "components/numerical_types/Big_Float.h"
+#include "components/numerical_types/Batch.h"
+#include "components/numerical_types/Binary_Format.h"
+#include "components/numerical_types/Literals.h"
\ No newline at end of file
@@ -0,0 +1,534 @@
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+
+/*
+    apm_bench - times the operations of every numerical type over a range of
+    operand sizes, and prints the results as JSON so runs can be compared.
+
+        apm_bench [--max-limbs N] [--max-scale N] [--budget SECONDS]
+                  [--limit SECONDS] [--filter TEXT] [--out FILE]
+
+    Each measurement repeats an operation for about 'budget' seconds.  Within
+    a series, a size whose predicted time per operation passes 'limit' seconds
+    is recorded as skipped, along with every larger size.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include "APM.h"
+#include "components/Thread_Pool.h"
+
+using namespace Olly;
+using namespace Olly::APM;
+
+struct Options {
+    Size   max_limbs = 100000;
+    Size   max_scale = 10000;
+    double budget    = 0.2;
+    double limit     = 5.0;
+    Text   filter;
+    Text   out;
+};
+
+struct Result {
+    Text    group;
+    Text    op;
+    Text    unit;
+    Size    size;
+    double  ns_per_op;
+    Size    iterations;
+    Boolean skipped;
+};
+
+typedef std::function<void()>                Operation;
+typedef std::function<Operation(Size size)>  Setup;       // Build the operands of a size, and return the timed operation.
+
+static Options             options;
+static std::vector<Result> results;
+static std::mt19937_64     generator(20221);
+static Size                sink = 0;                     // Keeps the results of the operations observable.
+
+static double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void series(const Text& group, const Text& op, const Text& unit, const std::vector<Size>& sizes, Setup setup) {
+    /*
+        Time the operation at each size.  The time of the last size measured,
+        grown as the square of the size, predicts the next one.
+    */
+
+    if (!options.filter.empty() && (group + "." + op).find(options.filter) == Text::npos) {
+        return;
+    }
+
+    double  last      = 0;
+    Size    last_size = 0;
+    Boolean skip      = false;
+
+    for (Size size : sizes) {
+
+        if (last_size) {
+            double ratio = static_cast<double>(size) / static_cast<double>(last_size);
+
+            skip = skip || last * ratio * ratio > options.limit;
+        }
+
+        if (skip) {
+            results.push_back({ group, op, unit, size, 0, 0, true });
+            continue;
+        }
+
+        Operation operation = setup(size);
+
+        auto start = std::chrono::steady_clock::now();
+
+        operation();
+
+        double first = seconds_since(start);
+
+        Size iterations = (first >= options.budget) ? 1 : static_cast<Size>(options.budget / (first > 1e-9 ? first : 1e-9));
+        iterations = (iterations < 1000000) ? iterations : 1000000;
+        iterations = (iterations > 0) ? iterations : 1;
+
+        start = std::chrono::steady_clock::now();
+
+        for (Size i = 0; i < iterations; ++i) {
+            operation();
+        }
+
+        last      = seconds_since(start) / static_cast<double>(iterations);
+        last_size = size;
+
+        results.push_back({ group, op, unit, size, last * 1e9, iterations, false });
+
+        std::cerr << group << "." << op << " " << size << " " << unit << ": " << last * 1e9 << " ns" << std::endl;
+    }
+}
+
+static void put_random_words(Binary_Format::Bytes& bytes, Size limbs) {
+    /*
+        Append the count and words of a random magnitude of exactly 'limbs' 64 bit
+        words, in the layout of 'Binary_Format'.  The top word is never zero.
+    */
+
+    auto put = [&bytes](std::uint64_t word) {
+
+        for (Size i = 0; i < 8; ++i) {
+            bytes.push_back(static_cast<std::uint8_t>(word >> (8 * i)));
+        }
+    };
+
+    put(limbs);
+
+    for (Size i = 0; i < limbs; ++i) {
+
+        std::uint64_t word = generator();
+
+        put((i + 1 < limbs || word) ? word : 1);
+    }
+}
+
+template<typename T>
+static T random_number(const T& positive, Size limbs, Size magnitudes) {
+    /*
+        Build a number from the header of a positive number's encoding and random
+        magnitudes, which takes time linear in its length at any size.
+    */
+
+    Binary_Format::Bytes bytes;
+
+    Binary_Format::encode(positive, bytes);
+
+    bytes.resize(Binary_Format::HEADER - 8);
+
+    for (Size i = 0; i < magnitudes; ++i) {
+        put_random_words(bytes, limbs);
+    }
+
+    T a;
+
+    Binary_Format::decode(bytes.data(), bytes.size(), a);
+
+    return a;
+}
+
+static Whole_Number random_whole(Size limbs) {
+    return random_number(Whole_Number(1), limbs, 1);
+}
+
+static Rational random_rational(Size limbs) {
+    return random_number(Rational("1/1"), limbs, 2);
+}
+
+static Text random_fraction(Size digits) {
+    /*
+        The text of a number in (0, 1) with 'digits' random decimal digits.
+    */
+
+    Text text = "0.";
+
+    text.reserve(digits + 2);
+
+    for (Size i = 0; i < digits; ++i) {
+        text += static_cast<Char>('0' + generator() % 10);
+    }
+
+    return text;
+}
+
+static Text bare_digits(const Whole_Number& a, Size base) {
+    /*
+        The digits of 'a' without the prefix or commas of 'to_string'.
+    */
+
+    Text text = a.to_string(base);
+
+    if (base != 10) {
+        return text.substr(2);
+    }
+
+    text.erase(std::remove(text.begin(), text.end(), ','), text.end());
+
+    return text;
+}
+
+static std::vector<Size> limb_sizes(Size largest) {
+
+    std::vector<Size> sizes;
+
+    for (Size n : { 1, 4, 16, 64, 256, 1024, 4096, 16384, 65536, 100000 }) {
+
+        if (n <= largest) {
+            sizes.push_back(n);
+        }
+    }
+
+    return sizes;
+}
+
+static void whole_numbers() {
+
+    const std::vector<Size> sizes = limb_sizes(options.max_limbs);
+
+    series("whole", "add", "limbs", sizes, [](Size n) -> Operation {
+
+        auto a = std::make_shared<Whole_Number>(random_whole(n));
+        auto b = std::make_shared<Whole_Number>(random_whole(n));
+
+        return [=]() { sink += (*a + *b).is(); };
+    });
+
+    series("whole", "sub", "limbs", sizes, [](Size n) -> Operation {
+
+        auto b = std::make_shared<Whole_Number>(random_whole(n));
+        auto a = std::make_shared<Whole_Number>(*b + random_whole(n));
+
+        return [=]() { sink += (*a - *b).is(); };
+    });
+
+    series("whole", "mul", "limbs", sizes, [](Size n) -> Operation {
+
+        auto a = std::make_shared<Whole_Number>(random_whole(n));
+        auto b = std::make_shared<Whole_Number>(random_whole(n));
+
+        return [=]() { sink += (*a * *b).is(); };
+    });
+
+    series("whole", "sqr", "limbs", sizes, [](Size n) -> Operation {
+
+        auto a = std::make_shared<Whole_Number>(random_whole(n));
+
+        return [=]() { sink += (*a * *a).is(); };
+    });
+
+    series("whole", "div", "limbs", sizes, [](Size n) -> Operation {   // A 2n limb dividend by an n limb divisor.
+
+        auto a = std::make_shared<Whole_Number>(random_whole(2 * n));
+        auto b = std::make_shared<Whole_Number>(random_whole(n));
+
+        return [=]() { sink += (*a / *b).is(); };
+    });
+
+    series("whole", "shl", "limbs", sizes, [](Size n) -> Operation {
+
+        auto a = std::make_shared<Whole_Number>(random_whole(n));
+
+        return [=]() { sink += (*a << 37).is(); };
+    });
+
+    series("whole", "shr", "limbs", sizes, [](Size n) -> Operation {
+
+        auto a = std::make_shared<Whole_Number>(random_whole(n));
+
+        return [=]() { sink += (*a >> 37).is(); };
+    });
+
+    series("whole", "compare", "limbs", sizes, [](Size n) -> Operation {  // Equal but for the lowest limb.
+
+        auto a = std::make_shared<Whole_Number>(random_whole(n));
+        auto b = std::make_shared<Whole_Number>(*a + Whole_Number(1));
+
+        return [=]() { sink += static_cast<Size>(a->compare(*b) < 0); };
+    });
+
+    for (Size base : { 2, 8, 10, 16 }) {
+
+        series("whole", "print_base_" + std::to_string(base), "limbs", sizes, [base](Size n) -> Operation {
+
+            auto a = std::make_shared<Whole_Number>(random_whole(n));
+
+            return [=]() { sink += a->to_string(base).size(); };
+        });
+
+        series("whole", "parse_base_" + std::to_string(base), "limbs", sizes, [base](Size n) -> Operation {
+
+            auto text = std::make_shared<Text>(bare_digits(random_whole(n), base));
+
+            return [=]() { sink += Whole_Number(*text, base).is(); };
+        });
+    }
+}
+
+static void rationals() {
+
+    const std::vector<Size> sizes = limb_sizes(options.max_limbs);
+
+    typedef Rational(*Binary)(const Rational&, const Rational&);
+
+    const std::vector<std::pair<Text, Binary>> ops = {
+        { "add", [](const Rational& a, const Rational& b) { return a + b; } },
+        { "sub", [](const Rational& a, const Rational& b) { return a - b; } },
+        { "mul", [](const Rational& a, const Rational& b) { return a * b; } },
+        { "div", [](const Rational& a, const Rational& b) { return a / b; } },
+    };
+
+    for (const auto& op : ops) {
+
+        Binary f = op.second;
+
+        series("rational", op.first, "limbs", sizes, [=](Size n) -> Operation {
+
+            auto a = std::make_shared<Rational>(random_rational(n));
+            auto b = std::make_shared<Rational>(random_rational(n));
+
+            return [=]() { sink += f(*a, *b).is(); };
+        });
+    }
+
+    series("rational", "compare", "limbs", sizes, [](Size n) -> Operation {
+
+        auto a = std::make_shared<Rational>(random_rational(n));
+        auto b = std::make_shared<Rational>(random_rational(n));
+
+        return [=]() { sink += static_cast<Size>(a->compare(*b) < 0); };
+    });
+}
+
+static void decimals() {
+    /*
+        Each function is timed at several scales, on an argument within its domain:
+        'x' is in (0, 1), and 'y' in (1, 2).
+    */
+
+    std::vector<Size> scales;
+
+    for (Size n : { 32, 100, 1000, 10000, 100000 }) {
+
+        if (n <= options.max_scale) {
+            scales.push_back(n);
+        }
+    }
+
+    typedef Decimal(*Function)(const Decimal& x, const Decimal& y);
+
+    const std::vector<std::pair<Text, Function>> ops = {
+        { "add",          [](const Decimal& x, const Decimal& y) { return x + y; } },
+        { "sub",          [](const Decimal& x, const Decimal& y) { return x - y; } },
+        { "mul",          [](const Decimal& x, const Decimal& y) { return x * y; } },
+        { "div",          [](const Decimal& x, const Decimal& y) { return x / y; } },
+        { "sqrt",         [](const Decimal&, const Decimal& y) { return y.sqrt(); } },
+        { "inverse",      [](const Decimal&, const Decimal& y) { return y.inverse(); } },
+        { "inverse_sqrt", [](const Decimal&, const Decimal& y) { return y.inverse_sqrt(); } },
+        { "pow",          [](const Decimal& x, const Decimal& y) { return y.pow(x); } },
+        { "root",         [](const Decimal&, const Decimal& y) { return y.root(Decimal("3")); } },
+        { "hypot",        [](const Decimal& x, const Decimal& y) { return x.hypot(y); } },
+        { "exp",          [](const Decimal&, const Decimal& y) { return y.exp(); } },
+        { "ln",           [](const Decimal&, const Decimal& y) { return y.ln(); } },
+        { "log2",         [](const Decimal&, const Decimal& y) { return y.log2(); } },
+        { "log10",        [](const Decimal&, const Decimal& y) { return y.log10(); } },
+        { "sin",          [](const Decimal&, const Decimal& y) { return y.sin(); } },
+        { "cos",          [](const Decimal&, const Decimal& y) { return y.cos(); } },
+        { "tan",          [](const Decimal&, const Decimal& y) { return y.tan(); } },
+        { "radian_sin",   [](const Decimal&, const Decimal& y) { return y.radian_sin(); } },
+        { "radian_cos",   [](const Decimal&, const Decimal& y) { return y.radian_cos(); } },
+        { "radian_tan",   [](const Decimal&, const Decimal& y) { return y.radian_tan(); } },
+        { "asin",         [](const Decimal& x, const Decimal&) { return x.asin(); } },
+        { "acos",         [](const Decimal& x, const Decimal&) { return x.acos(); } },
+        { "atan",         [](const Decimal&, const Decimal& y) { return y.atan(); } },
+        { "sinh",         [](const Decimal&, const Decimal& y) { return y.sinh(); } },
+        { "cosh",         [](const Decimal&, const Decimal& y) { return y.cosh(); } },
+        { "tanh",         [](const Decimal&, const Decimal& y) { return y.tanh(); } },
+        { "asinh",        [](const Decimal&, const Decimal& y) { return y.asinh(); } },
+        { "acosh",        [](const Decimal&, const Decimal& y) { return y.acosh(); } },
+        { "atanh",        [](const Decimal& x, const Decimal&) { return x.atanh(); } },
+    };
+
+    for (const auto& op : ops) {
+
+        Function f = op.second;
+
+        series("decimal", op.first, "digits", scales, [=](Size n) -> Operation {
+
+            Decimal::scale(static_cast<sys_int>(n));
+
+            auto x = std::make_shared<Decimal>(random_fraction(n));
+            auto y = std::make_shared<Decimal>(Decimal("1") + Decimal(random_fraction(n)));
+
+            return [=]() {
+
+                Decimal::scale(static_cast<sys_int>(n));
+
+                sink += f(*x, *y).is();
+            };
+        });
+    }
+
+    Decimal::scale(Decimal_Context::DEF_SCALE);
+}
+
+static Text compiler() {
+
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+static void write_json(std::ostream& out) {
+
+    out << "{\n";
+    out << "  \"build\": {\"compiler\": \"" << compiler() << "\", \"limb_bits\": " << std::numeric_limits<Whole_Number::Word>::digits
+        << ", \"threads\": " << Thread_Pool::shared().size() << "},\n";
+    out << "  \"options\": {\"max_limbs\": " << options.max_limbs << ", \"max_scale\": " << options.max_scale
+        << ", \"budget\": " << options.budget << ", \"limit\": " << options.limit << "},\n";
+    out << "  \"results\": [";
+
+    for (Size i = 0; i < results.size(); ++i) {
+
+        const Result& r = results[i];
+
+        out << (i ? ",\n" : "\n") << "    {\"group\": \"" << r.group << "\", \"op\": \"" << r.op << "\", \"" << r.unit << "\": " << r.size;
+
+        if (r.skipped) {
+            out << ", \"skipped\": true}";
+        }
+        else {
+            out << ", \"ns_per_op\": " << r.ns_per_op << ", \"iterations\": " << r.iterations << "}";
+        }
+    }
+
+    out << "\n  ]\n}\n";
+}
+
+static Boolean parse_options(int argc, char* argv[]) {
+
+    for (int i = 1; i < argc; ++i) {
+
+        Text option = argv[i];
+
+        if (i + 1 >= argc) {
+            return false;
+        }
+
+        Text value = argv[++i];
+
+        if (option == "--max-limbs") {
+            options.max_limbs = std::stoull(value);
+        }
+        else if (option == "--max-scale") {
+            options.max_scale = std::stoull(value);
+        }
+        else if (option == "--budget") {
+            options.budget = std::stod(value);
+        }
+        else if (option == "--limit") {
+            options.limit = std::stod(value);
+        }
+        else if (option == "--filter") {
+            options.filter = value;
+        }
+        else if (option == "--out") {
+            options.out = value;
+        }
+        else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+
+    try {
+        if (!parse_options(argc, argv)) {
+
+            std::cerr << "usage: apm_bench [--max-limbs N] [--max-scale N] [--budget SECONDS]"
+                      << " [--limit SECONDS] [--filter TEXT] [--out FILE]" << std::endl;
+            return 2;
+        }
+    }
+    catch (const std::exception&) {
+        std::cerr << "apm_bench: invalid option value" << std::endl;
+        return 2;
+    }
+
+    whole_numbers();
+    rationals();
+    decimals();
+
+    if (options.out.empty()) {
+        write_json(std::cout);
+    }
+    else {
+        std::ofstream file(options.out);
+
+        write_json(file);
+    }
+
+    return sink == Size(-1);
+}
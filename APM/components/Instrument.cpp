@@ -0,0 +1,247 @@
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+
+#include <algorithm>
+#include <mutex>
+#include "Instrument.h"
+
+namespace Olly {
+    namespace APM {
+
+#ifdef APM_INSTRUMENT
+        const Boolean Instrument::ENABLED = true;
+#else
+        const Boolean Instrument::ENABLED = false;
+#endif
+
+        std::uint64_t Instrument::Counters::operator[](COUNTER c) const {
+            return values[static_cast<Size>(c)];
+        }
+
+        const char* Instrument::name(COUNTER c) {
+
+            static const char* names[COUNTERS] = {
+                "add", "sub", "mul_basecase", "mul_karatsuba", "mul_parallel", "div", "shift", "parse", "to_string",
+                "allocations", "frees", "bytes_allocated", "bytes_freed", "limbs_live", "limbs_peak"
+            };
+
+            return (static_cast<Size>(c) < COUNTERS) ? names[static_cast<Size>(c)] : "";
+        }
+
+#ifdef APM_INSTRUMENT
+
+        /********************************************************************************************/
+        //
+        //                              'Thread_Counters' Class Definition
+        //
+        //        The counters of one thread.  Only the owning thread writes them, so a plain
+        //        load and store suffices, while the atomics let 'total' read them safely.  A
+        //        thread's counters are added to the retired totals when it exits.
+        //
+        /********************************************************************************************/
+
+        class Thread_Counters;
+
+        static std::mutex& registry_lock() {
+
+            static std::mutex* lock = new std::mutex();     // Never destroyed, as threads may exit late.
+
+            return *lock;
+        }
+
+        static std::vector<Thread_Counters*>& registry() {
+
+            static std::vector<Thread_Counters*>* threads = new std::vector<Thread_Counters*>();
+
+            return *threads;
+        }
+
+        static Instrument::Counters& retired() {
+
+            static Instrument::Counters* counters = new Instrument::Counters();
+
+            return *counters;
+        }
+
+        static std::atomic<std::uint64_t> limbs_live{ 0 };
+        static std::atomic<std::uint64_t> limbs_peak{ 0 };
+
+        class Thread_Counters {
+
+        public:
+
+            std::array<std::atomic<std::uint64_t>, Instrument::COUNTERS> values{};
+
+            Thread_Counters() {
+
+                std::lock_guard<std::mutex> hold(registry_lock());
+
+                registry().push_back(this);
+            }
+
+            ~Thread_Counters();
+
+            void add(Instrument::COUNTER c, std::uint64_t n) {
+
+                auto& value = values[static_cast<Size>(c)];
+
+                value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+            }
+
+            void add_to(Instrument::Counters& counters) const {
+
+                for (Size i = 0; i < Instrument::COUNTERS; ++i) {
+                    counters.values[i] += values[i].load(std::memory_order_relaxed);
+                }
+            }
+        };
+
+        static thread_local Boolean         counters_exited = false;    // Storage freed once the thread's
+        static thread_local Thread_Counters local_counters;             // counters are gone is not counted.
+
+        Thread_Counters::~Thread_Counters() {
+
+            std::lock_guard<std::mutex> hold(registry_lock());
+
+            add_to(retired());
+
+            auto& threads = registry();
+
+            threads.erase(std::remove(threads.begin(), threads.end(), this), threads.end());
+
+            counters_exited = true;
+        }
+
+        static Thread_Counters* local() {
+
+            if (counters_exited) {
+                return nullptr;
+            }
+
+            return &local_counters;
+        }
+
+        static void set_limbs(Instrument::Counters& counters) {
+
+            counters.values[static_cast<Size>(Instrument::COUNTER::limbs_live)] = limbs_live.load(std::memory_order_relaxed);
+            counters.values[static_cast<Size>(Instrument::COUNTER::limbs_peak)] = limbs_peak.load(std::memory_order_relaxed);
+        }
+
+        Instrument::Counters Instrument::snapshot() {
+
+            Counters counters;
+
+            if (Thread_Counters* c = local()) {
+                c->add_to(counters);
+            }
+
+            set_limbs(counters);
+
+            return counters;
+        }
+
+        Instrument::Counters Instrument::total() {
+
+            std::lock_guard<std::mutex> hold(registry_lock());
+
+            Counters counters = retired();
+
+            for (const Thread_Counters* c : registry()) {
+                c->add_to(counters);
+            }
+
+            set_limbs(counters);
+
+            return counters;
+        }
+
+        void Instrument::reset() {
+
+            if (Thread_Counters* c = local()) {
+
+                for (auto& value : c->values) {
+                    value.store(0, std::memory_order_relaxed);
+                }
+            }
+
+            limbs_peak.store(limbs_live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        void Instrument::count(COUNTER c, std::uint64_t n) {
+
+            if (Thread_Counters* counters = local()) {
+                counters->add(c, n);
+            }
+        }
+
+        void Instrument::allocate(Size bytes, Size limbs) {
+
+            if (Thread_Counters* counters = local()) {
+                counters->add(COUNTER::allocations, 1);
+                counters->add(COUNTER::bytes_allocated, bytes);
+            }
+
+            std::uint64_t live = limbs_live.fetch_add(limbs, std::memory_order_relaxed) + limbs;
+            std::uint64_t peak = limbs_peak.load(std::memory_order_relaxed);
+
+            while (live > peak && !limbs_peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+            }
+        }
+
+        void Instrument::release(Size bytes, Size limbs) {
+
+            if (Thread_Counters* counters = local()) {
+                counters->add(COUNTER::frees, 1);
+                counters->add(COUNTER::bytes_freed, bytes);
+            }
+
+            limbs_live.fetch_sub(limbs, std::memory_order_relaxed);
+        }
+
+#else
+
+        Instrument::Counters Instrument::snapshot() {
+            return Counters();
+        }
+
+        Instrument::Counters Instrument::total() {
+            return Counters();
+        }
+
+        void Instrument::reset() {
+        }
+
+        void Instrument::count(COUNTER, std::uint64_t) {
+        }
+
+        void Instrument::allocate(Size, Size) {
+        }
+
+        void Instrument::release(Size, Size) {
+        }
+
+#endif
+    }
+}
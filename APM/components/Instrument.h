@@ -0,0 +1,143 @@
+#pragma once
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "sys/config.h"
+
+/*  Define APM_INSTRUMENT to count the calls of the Whole_Number primitives, and the limb
+    storage allocated, on every thread.  Without it the hooks below compile to nothing.  */
+
+#ifdef APM_INSTRUMENT
+#define APM_COUNT(counter) ::Olly::APM::Instrument::count(::Olly::APM::Instrument::COUNTER::counter)
+#else
+#define APM_COUNT(counter) ((void)0)
+#endif
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                              'Instrument' Class Declaration
+        //
+        //        Counters kept by each thread of the primitives called and the limb storage
+        //        allocated and freed.  A snapshot reads the calling thread's counters, a total
+        //        adds those of every thread, exited threads included.  The live and peak limbs
+        //        are of the whole process, since storage may be freed on another thread.
+        //
+        //        A build without APM_INSTRUMENT keeps no counters, and reports zeros.
+        //
+        /********************************************************************************************/
+
+        class Instrument {
+
+        public:
+
+            enum class COUNTER {
+                add = 0, sub, mul_basecase, mul_karatsuba, mul_parallel, div, shift, parse, to_string,
+                allocations, frees, bytes_allocated, bytes_freed, limbs_live, limbs_peak, count
+            };
+
+            static const Size COUNTERS = static_cast<Size>(COUNTER::count);
+
+            struct Counters {
+
+                std::array<std::uint64_t, COUNTERS> values{};
+
+                std::uint64_t operator[](COUNTER c) const;
+            };
+
+            static const Boolean ENABLED;                   // Whether the library counts.
+
+            static const char* name(COUNTER c);
+
+            static Counters snapshot();                     // The counters of the calling thread.
+            static Counters total();                        // The counters of every thread.
+            static void     reset();                        // Zero the calling thread's counters, and
+                                                            // restart the peak at the live limbs.
+
+            static void count(COUNTER c, std::uint64_t n = 1);
+            static void allocate(Size bytes, Size limbs);
+            static void release(Size bytes, Size limbs);
+        };
+
+        /********************************************************************************************/
+        //
+        //                              'Counting_Allocator' Class
+        //
+        //        The allocator of the limb storage when instrumented, which reports each
+        //        allocation before passing it on to 'std::allocator'.
+        //
+        /********************************************************************************************/
+
+        template<typename T>
+        class Counting_Allocator {
+
+        public:
+
+            typedef T value_type;
+
+            Counting_Allocator() = default;
+
+            template<typename U>
+            Counting_Allocator(const Counting_Allocator<U>&) {
+            }
+
+            T* allocate(Size n) {
+
+                Instrument::allocate(n * sizeof(T), n);
+
+                return std::allocator<T>().allocate(n);
+            }
+
+            void deallocate(T* p, Size n) {
+
+                Instrument::release(n * sizeof(T), n);
+
+                std::allocator<T>().deallocate(p, n);
+            }
+
+            template<typename U>
+            Boolean operator==(const Counting_Allocator<U>&) const {
+                return true;
+            }
+
+            template<typename U>
+            Boolean operator!=(const Counting_Allocator<U>&) const {
+                return false;
+            }
+        };
+
+#ifdef APM_INSTRUMENT
+        template<typename N> using Limb_Vector = std::vector<N, Counting_Allocator<N>>;
+#else
+        template<typename N> using Limb_Vector = std::vector<N>;
+#endif
+    }
+}
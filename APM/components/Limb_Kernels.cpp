@@ -0,0 +1,568 @@
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+
+#include <cstdlib>
+#include "Limb_Kernels.h"
+
+#ifdef APM_LIMB_DISPATCH
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                                  Kernel Variants
+        //
+        //        The portable variant is the kernel templates themselves.  The others are:
+        //
+        //            bmi2    the templates built for BMI2, so each word product is a MULX.
+        //            adx     carry chains through the add with carry intrinsics.
+        //            avx2    as adx, with the bitwise kernels and shifts on 256 bit vectors.
+        //            avx512  as adx, with the bitwise kernels and shifts on 512 bit vectors.
+        //
+        //        A shift runs in the same direction as the template, so the same overlapping
+        //        operands are allowed: a left shift from the top, a right shift from the bottom.
+        //
+        /********************************************************************************************/
+
+        typedef Limb_Variant::W W;
+
+        static const Limb_Variant portable_variant = {
+            "portable",
+            &add_n<W>, &sub_n<W>, &mul_1<W>, &addmul_1<W>, &submul_1<W>, &lshift<W>, &rshift<W>,
+            &and_n<W>, &or_n<W>, &xor_n<W>, &com_n<W>
+        };
+
+#ifdef APM_LIMB_DISPATCH
+
+        std::atomic<const Limb_Variant*> active_limb_variant{ &portable_variant };
+
+        /*  BMI2, the templates built with MULX, SHLX and SHRX.  */
+
+#define APM_BMI2 __attribute__((target("bmi2"), flatten))
+
+        APM_BMI2 static W bmi2_add_n(W* r, const W* a, const W* b, Size n)    { return add_n<W>(r, a, b, n); }
+        APM_BMI2 static W bmi2_sub_n(W* r, const W* a, const W* b, Size n)    { return sub_n<W>(r, a, b, n); }
+        APM_BMI2 static W bmi2_mul_1(W* r, const W* a, Size n, W b)           { return mul_1<W>(r, a, n, b); }
+        APM_BMI2 static W bmi2_addmul_1(W* r, const W* a, Size n, W b)        { return addmul_1<W>(r, a, n, b); }
+        APM_BMI2 static W bmi2_submul_1(W* r, const W* a, Size n, W b)        { return submul_1<W>(r, a, n, b); }
+        APM_BMI2 static W bmi2_lshift(W* r, const W* a, Size n, Size bits)    { return lshift<W>(r, a, n, bits); }
+        APM_BMI2 static W bmi2_rshift(W* r, const W* a, Size n, Size bits)    { return rshift<W>(r, a, n, bits); }
+
+#undef APM_BMI2
+
+        /*  ADX, the carry of each word kept in the carry flag.  */
+
+#define APM_ADX __attribute__((target("bmi2,adx")))
+
+        APM_ADX static W adx_add_n(W* r, const W* a, const W* b, Size n) {
+
+            unsigned char      carry = 0;
+            unsigned long long t;
+
+            Size i = 0;
+
+            for (; i + 4 <= n; i += 4) {
+                carry = _addcarryx_u64(carry, a[i],     b[i],     &t); r[i]     = t;
+                carry = _addcarryx_u64(carry, a[i + 1], b[i + 1], &t); r[i + 1] = t;
+                carry = _addcarryx_u64(carry, a[i + 2], b[i + 2], &t); r[i + 2] = t;
+                carry = _addcarryx_u64(carry, a[i + 3], b[i + 3], &t); r[i + 3] = t;
+            }
+
+            for (; i < n; i += 1) {
+                carry = _addcarryx_u64(carry, a[i], b[i], &t); r[i] = t;
+            }
+
+            return carry;
+        }
+
+        APM_ADX static W adx_sub_n(W* r, const W* a, const W* b, Size n) {
+
+            unsigned char      borrow = 0;
+            unsigned long long t;
+
+            Size i = 0;
+
+            for (; i + 4 <= n; i += 4) {
+                borrow = _subborrow_u64(borrow, a[i],     b[i],     &t); r[i]     = t;
+                borrow = _subborrow_u64(borrow, a[i + 1], b[i + 1], &t); r[i + 1] = t;
+                borrow = _subborrow_u64(borrow, a[i + 2], b[i + 2], &t); r[i + 2] = t;
+                borrow = _subborrow_u64(borrow, a[i + 3], b[i + 3], &t); r[i + 3] = t;
+            }
+
+            for (; i < n; i += 1) {
+                borrow = _subborrow_u64(borrow, a[i], b[i], &t); r[i] = t;
+            }
+
+            return borrow;
+        }
+
+        APM_ADX static W adx_mul_1(W* r, const W* a, Size n, W b) {
+
+            unsigned long long carry = 0;
+
+            for (Size i = 0; i < n; i += 1) {
+
+                unsigned long long hi;
+                unsigned long long lo = _mulx_u64(a[i], b, &hi);
+
+                carry = hi + _addcarryx_u64(0, lo, carry, &lo);
+
+                r[i] = lo;
+            }
+
+            return carry;
+        }
+
+        APM_ADX static W adx_addmul_1(W* r, const W* a, Size n, W b) {
+            /*
+                The high word of a product is at most 2^64 - 2, so it absorbs
+                both carries without overflow.
+            */
+
+            unsigned long long carry = 0;
+
+            for (Size i = 0; i < n; i += 1) {
+
+                unsigned long long hi, t;
+                unsigned long long lo = _mulx_u64(a[i], b, &hi);
+
+                hi += _addcarryx_u64(0, lo, carry, &lo);
+                hi += _addcarryx_u64(0, r[i], lo, &t);
+
+                r[i]  = t;
+                carry = hi;
+            }
+
+            return carry;
+        }
+
+        APM_ADX static W adx_submul_1(W* r, const W* a, Size n, W b) {
+
+            unsigned long long borrow = 0;
+
+            for (Size i = 0; i < n; i += 1) {
+
+                unsigned long long hi, t;
+                unsigned long long lo = _mulx_u64(a[i], b, &hi);
+
+                hi += _addcarryx_u64(0, lo, borrow, &lo);
+                hi += _subborrow_u64(0, r[i], lo, &t);
+
+                r[i]   = t;
+                borrow = hi;
+            }
+
+            return borrow;
+        }
+
+#undef APM_ADX
+
+        /*  AVX2, four words to a vector.  */
+
+#define APM_AVX2 __attribute__((target("avx2,bmi2,adx")))
+
+        APM_AVX2 static void avx2_and_n(W* r, const W* a, const W* b, Size n) {
+
+            Size i = 0;
+
+            for (; i + 4 <= n; i += 4) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+                __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), _mm256_and_si256(x, y));
+            }
+
+            for (; i < n; i += 1) {
+                r[i] = a[i] & b[i];
+            }
+        }
+
+        APM_AVX2 static void avx2_or_n(W* r, const W* a, const W* b, Size n) {
+
+            Size i = 0;
+
+            for (; i + 4 <= n; i += 4) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+                __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), _mm256_or_si256(x, y));
+            }
+
+            for (; i < n; i += 1) {
+                r[i] = a[i] | b[i];
+            }
+        }
+
+        APM_AVX2 static void avx2_xor_n(W* r, const W* a, const W* b, Size n) {
+
+            Size i = 0;
+
+            for (; i + 4 <= n; i += 4) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+                __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), _mm256_xor_si256(x, y));
+            }
+
+            for (; i < n; i += 1) {
+                r[i] = a[i] ^ b[i];
+            }
+        }
+
+        APM_AVX2 static void avx2_com_n(W* r, const W* a, Size n) {
+
+            const __m256i ones = _mm256_set1_epi64x(-1);
+
+            Size i = 0;
+
+            for (; i + 4 <= n; i += 4) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), _mm256_xor_si256(x, ones));
+            }
+
+            for (; i < n; i += 1) {
+                r[i] = ~a[i];
+            }
+        }
+
+        APM_AVX2 static W avx2_lshift(W* r, const W* a, Size n, Size bits) {
+
+            if (n == 0 || bits == 0) {
+                return lshift<W>(r, a, n, bits);
+            }
+
+            const Size    inv   = 64 - bits;
+            const __m128i left  = _mm_cvtsi64_si128(static_cast<long long>(bits));
+            const __m128i right = _mm_cvtsi64_si128(static_cast<long long>(inv));
+
+            W out = a[n - 1] >> inv;
+
+            Size i = n - 1;
+
+            for (; i >= 4; i -= 4) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i - 3));
+                __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i - 4));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i - 3),
+                    _mm256_or_si256(_mm256_sll_epi64(x, left), _mm256_srl_epi64(y, right)));
+            }
+
+            for (; i > 0; i -= 1) {
+                r[i] = (a[i] << bits) | (a[i - 1] >> inv);
+            }
+
+            r[0] = a[0] << bits;
+
+            return out;
+        }
+
+        APM_AVX2 static W avx2_rshift(W* r, const W* a, Size n, Size bits) {
+
+            if (n == 0 || bits == 0) {
+                return rshift<W>(r, a, n, bits);
+            }
+
+            const Size    inv   = 64 - bits;
+            const __m128i right = _mm_cvtsi64_si128(static_cast<long long>(bits));
+            const __m128i left  = _mm_cvtsi64_si128(static_cast<long long>(inv));
+
+            W out = a[0] << inv;
+
+            Size i = 0;
+
+            for (; i + 5 <= n; i += 4) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+                __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 1));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i),
+                    _mm256_or_si256(_mm256_srl_epi64(x, right), _mm256_sll_epi64(y, left)));
+            }
+
+            for (; i + 1 < n; i += 1) {
+                r[i] = (a[i] >> bits) | (a[i + 1] << inv);
+            }
+
+            r[n - 1] = a[n - 1] >> bits;
+
+            return out;
+        }
+
+#undef APM_AVX2
+
+        /*  AVX-512, eight words to a vector.  */
+
+#define APM_AVX512 __attribute__((target("avx512f,avx2,bmi2,adx")))
+
+        // The shifts by a count are masked to all lanes, as the unmasked forms pass
+        // an undefined vector that GCC reports as maybe uninitialized.
+        static const __mmask8 ALL = 0xFF;
+
+        APM_AVX512 static void avx512_and_n(W* r, const W* a, const W* b, Size n) {
+
+            Size i = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                _mm512_storeu_si512(r + i, _mm512_and_si512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+            }
+
+            avx2_and_n(r + i, a + i, b + i, n - i);
+        }
+
+        APM_AVX512 static void avx512_or_n(W* r, const W* a, const W* b, Size n) {
+
+            Size i = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                _mm512_storeu_si512(r + i, _mm512_or_si512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+            }
+
+            avx2_or_n(r + i, a + i, b + i, n - i);
+        }
+
+        APM_AVX512 static void avx512_xor_n(W* r, const W* a, const W* b, Size n) {
+
+            Size i = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                _mm512_storeu_si512(r + i, _mm512_xor_si512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+            }
+
+            avx2_xor_n(r + i, a + i, b + i, n - i);
+        }
+
+        APM_AVX512 static void avx512_com_n(W* r, const W* a, Size n) {
+
+            const __m512i ones = _mm512_set1_epi64(-1);
+
+            Size i = 0;
+
+            for (; i + 8 <= n; i += 8) {
+                _mm512_storeu_si512(r + i, _mm512_xor_si512(_mm512_loadu_si512(a + i), ones));
+            }
+
+            avx2_com_n(r + i, a + i, n - i);
+        }
+
+        APM_AVX512 static W avx512_lshift(W* r, const W* a, Size n, Size bits) {
+
+            if (n == 0 || bits == 0) {
+                return lshift<W>(r, a, n, bits);
+            }
+
+            const Size    inv   = 64 - bits;
+            const __m128i left  = _mm_cvtsi64_si128(static_cast<long long>(bits));
+            const __m128i right = _mm_cvtsi64_si128(static_cast<long long>(inv));
+
+            W out = a[n - 1] >> inv;
+
+            Size i = n - 1;
+
+            for (; i >= 8; i -= 8) {
+                __m512i x = _mm512_loadu_si512(a + i - 7);
+                __m512i y = _mm512_loadu_si512(a + i - 8);
+                _mm512_storeu_si512(r + i - 7, _mm512_or_si512(_mm512_maskz_sll_epi64(ALL, x, left), _mm512_maskz_srl_epi64(ALL, y, right)));
+            }
+
+            for (; i > 0; i -= 1) {
+                r[i] = (a[i] << bits) | (a[i - 1] >> inv);
+            }
+
+            r[0] = a[0] << bits;
+
+            return out;
+        }
+
+        APM_AVX512 static W avx512_rshift(W* r, const W* a, Size n, Size bits) {
+
+            if (n == 0 || bits == 0) {
+                return rshift<W>(r, a, n, bits);
+            }
+
+            const Size    inv   = 64 - bits;
+            const __m128i right = _mm_cvtsi64_si128(static_cast<long long>(bits));
+            const __m128i left  = _mm_cvtsi64_si128(static_cast<long long>(inv));
+
+            W out = a[0] << inv;
+
+            Size i = 0;
+
+            for (; i + 9 <= n; i += 8) {
+                __m512i x = _mm512_loadu_si512(a + i);
+                __m512i y = _mm512_loadu_si512(a + i + 1);
+                _mm512_storeu_si512(r + i, _mm512_or_si512(_mm512_maskz_srl_epi64(ALL, x, right), _mm512_maskz_sll_epi64(ALL, y, left)));
+            }
+
+            for (; i + 1 < n; i += 1) {
+                r[i] = (a[i] >> bits) | (a[i + 1] << inv);
+            }
+
+            r[n - 1] = a[n - 1] >> bits;
+
+            return out;
+        }
+
+#undef APM_AVX512
+
+        static const Limb_Variant bmi2_variant = {
+            "bmi2",
+            &bmi2_add_n, &bmi2_sub_n, &bmi2_mul_1, &bmi2_addmul_1, &bmi2_submul_1, &bmi2_lshift, &bmi2_rshift,
+            &and_n<W>, &or_n<W>, &xor_n<W>, &com_n<W>
+        };
+
+        static const Limb_Variant adx_variant = {
+            "adx",
+            &adx_add_n, &adx_sub_n, &adx_mul_1, &adx_addmul_1, &adx_submul_1, &bmi2_lshift, &bmi2_rshift,
+            &and_n<W>, &or_n<W>, &xor_n<W>, &com_n<W>
+        };
+
+        static const Limb_Variant avx2_variant = {
+            "avx2",
+            &adx_add_n, &adx_sub_n, &adx_mul_1, &adx_addmul_1, &adx_submul_1, &avx2_lshift, &avx2_rshift,
+            &avx2_and_n, &avx2_or_n, &avx2_xor_n, &avx2_com_n
+        };
+
+        static const Limb_Variant avx512_variant = {
+            "avx512",
+            &adx_add_n, &adx_sub_n, &adx_mul_1, &adx_addmul_1, &adx_submul_1, &avx512_lshift, &avx512_rshift,
+            &avx512_and_n, &avx512_or_n, &avx512_xor_n, &avx512_com_n
+        };
+
+        static Boolean cpu_supports(const Limb_Variant* variant) {
+            /*
+                The features come from CPUID leaf 7.  The vector variants also need the
+                operating system to save the vector registers, as reported by XGETBV.
+            */
+
+            if (variant == &portable_variant) {
+                return true;
+            }
+
+            unsigned int eax, ebx, ecx, edx;
+
+            if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+                return false;
+            }
+
+            const Boolean bmi2    = ebx & (1u << 8);
+            const Boolean adx     = ebx & (1u << 19);
+            const Boolean avx2    = ebx & (1u << 5);
+            const Boolean avx512f = ebx & (1u << 16);
+
+            if (variant == &bmi2_variant) {
+                return bmi2;
+            }
+
+            if (variant == &adx_variant) {
+                return bmi2 && adx;
+            }
+
+            if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & (1u << 27))) {
+                return false;                                   // No OSXSAVE.
+            }
+
+            unsigned int xcr0_lo, xcr0_hi;
+
+            __asm__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+
+            const Boolean ymm = (xcr0_lo & 0x06) == 0x06;       // SSE and AVX state.
+            const Boolean zmm = (xcr0_lo & 0xe6) == 0xe6;       // And the opmask and upper ZMM state.
+
+            if (variant == &avx2_variant) {
+                return bmi2 && adx && avx2 && ymm;
+            }
+
+            return bmi2 && adx && avx2 && avx512f && zmm;
+        }
+
+        static const Limb_Variant* const all_variants[] = {
+            &portable_variant, &bmi2_variant, &adx_variant, &avx2_variant, &avx512_variant
+        };
+
+        static Boolean select_limb_variant() {
+            /*
+                Run once at startup.  Until then the portable variant serves any
+                kernel called during static initialization.
+            */
+
+            const char* forced = std::getenv("APM_LIMB_KERNELS");
+
+            if (forced && use_limb_variant(forced)) {
+                return true;
+            }
+
+            std::vector<const Limb_Variant*> supported = limb_variants();
+
+            active_limb_variant.store(supported.back(), std::memory_order_relaxed);
+
+            return true;
+        }
+
+        static const Boolean limb_variant_selected = select_limb_variant();
+
+        std::vector<const Limb_Variant*> limb_variants() {
+
+            std::vector<const Limb_Variant*> supported;
+
+            for (const Limb_Variant* variant : all_variants) {
+
+                if (cpu_supports(variant)) {
+                    supported.push_back(variant);
+                }
+            }
+
+            return supported;
+        }
+
+        Boolean use_limb_variant(const Text& name) {
+
+            for (const Limb_Variant* variant : all_variants) {
+
+                if (name == variant->name && cpu_supports(variant)) {
+
+                    active_limb_variant.store(variant, std::memory_order_relaxed);
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+#else
+
+        const Limb_Variant& limb_variant() {
+            return portable_variant;
+        }
+
+        std::vector<const Limb_Variant*> limb_variants() {
+            return { &portable_variant };
+        }
+
+        Boolean use_limb_variant(const Text& name) {
+            return name == portable_variant.name;
+        }
+
+#endif
+    }
+}
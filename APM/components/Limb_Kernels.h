@@ -0,0 +1,1034 @@
+#pragma once
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+#include "Instrument.h"
+#include "sys/config.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace Olly {
+
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                                  'Limb_Traits' struct
+        //
+        //        Pairs an unsigned limb type with the unsigned integral of twice its width.
+        //        When the platform offers no such integral 'Double' is void, and the word
+        //        operations below fall back to half word arithmetic.  Defining APM_NO_INT128
+        //        forces the fallback on compilers which do provide 'unsigned __int128'.
+        //
+        /********************************************************************************************/
+
+        template<Size BITS> struct Unsigned_Width      { typedef void              type; };
+        template<>          struct Unsigned_Width<16>  { typedef std::uint16_t     type; };
+        template<>          struct Unsigned_Width<32>  { typedef std::uint32_t     type; };
+        template<>          struct Unsigned_Width<64>  { typedef std::uint64_t     type; };
+#if defined(__SIZEOF_INT128__) && !defined(APM_NO_INT128)
+        template<>          struct Unsigned_Width<128> { typedef unsigned __int128 type; };
+#endif
+
+        template<typename N>
+        struct Limb_Traits {
+
+            static_assert(std::numeric_limits<N>::is_integer, "The limb type must be an unsigned integral.");
+            static_assert(!std::numeric_limits<N>::is_signed, "The limb type must be an unsigned integral.");
+
+            typedef typename Unsigned_Width<std::numeric_limits<N>::digits * 2>::type Double;
+
+            static const Size    BITS       = std::numeric_limits<N>::digits;
+            static const Size    HALF       = BITS / 2;
+            static const N       MASK       = ~N(0);
+            static const N       LOW        = MASK >> HALF;
+            static const Boolean HAS_DOUBLE = !std::is_void<Double>::value;
+        };
+
+        /********************************************************************************************/
+        //
+        //                                  Single Word Operations
+        //
+        /********************************************************************************************/
+
+        template<typename N> constexpr Size lead_zeros(N a);                     // Count the leading zero bits of a non zero word.
+        template<typename N> constexpr N    mul_wide(N a, N b, N& hi);           // Return the low word of a * b, the high word is set in 'hi'.
+        template<typename N> constexpr N    div_wide(N hi, N lo, N d, N& rem);   // Divide the double word hi:lo by 'd', requires hi < d.
+
+        // The reciprocal floor((B^2 - 1) / d) - B of a normalized 'd', its top bit set, with
+        // which 'div_preinv' divides by 'd' with multiplications alone (Moller and Granlund).
+        template<typename N> constexpr N    reciprocal_word(N d);
+        template<typename N> constexpr N    div_preinv(N hi, N lo, N d, N v, N& rem);
+
+        /********************************************************************************************/
+        //
+        //                                  Limb Vector Kernels
+        //
+        //        The kernels operate on little endian arrays of limbs.  Unless noted the result
+        //        may alias an operand.  Return values are the carry, borrow or remainder word.
+        //        The single pass kernels are constexpr, for use in constant expressions by
+        //        naming the limb type, as in 'add_n<Word>', which bypasses the dispatch below.
+        //
+        /********************************************************************************************/
+
+        template<typename N> constexpr sys_int cmp_n(const N* a, const N* b, Size n);             // Compare two equal length arrays.
+
+        template<typename N> constexpr N add_n(N* r, const N* a, const N* b, Size n);             // r = a + b.
+        template<typename N> constexpr N add_1(N* r, const N* a, Size n, N b);                    // r = a + b.
+        template<typename N> constexpr N sub_n(N* r, const N* a, const N* b, Size n);             // r = a - b.
+        template<typename N> constexpr N sub_1(N* r, const N* a, Size n, N b);                    // r = a - b.
+
+        template<typename N> constexpr N mul_1(N* r, const N* a, Size n, N b);                    // r  = a * b.
+        template<typename N> constexpr N addmul_1(N* r, const N* a, Size n, N b);                 // r += a * b.
+        template<typename N> constexpr N submul_1(N* r, const N* a, Size n, N b);                 // r -= a * b.
+
+        template<typename N> constexpr N lshift(N* r, const N* a, Size n, Size bits);             // r = a << bits, bits < BITS.
+        template<typename N> constexpr N rshift(N* r, const N* a, Size n, Size bits);             // r = a >> bits, bits < BITS.
+
+        template<typename N> constexpr N divrem_1(N* q, const N* a, Size n, N d);                 // q = a / d, return a % d.
+
+        // As 'divrem_1', by the divisor shifted left 'shift' bits to 'd', whose reciprocal is 'v'.
+        template<typename N> constexpr N divrem_1_preinv(N* q, const N* a, Size n, N d, Size shift, N v);
+
+        template<typename N> constexpr void and_n(N* r, const N* a, const N* b, Size n);          // r = a & b.
+        template<typename N> constexpr void or_n (N* r, const N* a, const N* b, Size n);          // r = a | b.
+        template<typename N> constexpr void xor_n(N* r, const N* a, const N* b, Size n);          // r = a ^ b.
+        template<typename N> constexpr void com_n(N* r, const N* a, Size n);                      // r = ~a.
+
+        static const Size KARATSUBA_THRESHOLD = 32;     // The fewest words Karatsuba's method splits.
+
+        // r = a * b, 'r' must hold na + nb words and may not alias either operand.
+        template<typename N> void mul_basecase(N* r, const N* a, Size na, const N* b, Size nb);
+
+        // r = a * b for operands of n words each, 't' holds 'mul_scratch(n)' words of scratch.
+        template<typename N> void mul_karatsuba(N* r, const N* a, const N* b, Size n, N* t);
+        Size mul_scratch(Size n);
+
+        // r = a * b, requires na >= nb >= 1.  Selects the basecase or Karatsuba's method.
+        template<typename N> void mul(N* r, const N* a, Size na, const N* b, Size nb);
+
+        static const Size SHORT_PRODUCT_THRESHOLD = 48;     // The fewest words a short product splits.
+
+        // The short products of operands of n words each.  'mulhigh_n' sets the n + 2 words of
+        // 'r' to the partial products of word n - 2 and above, shifted down n - 2 words, so the
+        // top n words fall short of those of a * b by at most one.  Requires n >= 2.
+        // 'mullow_n' sets the n words of 'r' to a * b mod B^n.  Neither 'r' may alias an operand.
+        template<typename N> void mulhigh_n(N* r, const N* a, const N* b, Size n);
+        template<typename N> void mullow_n (N* r, const N* a, const N* b, Size n);
+
+        // q = a / b and r = a % b, requires na >= nb >= 2 and b[nb - 1] != 0.  'q' holds
+        // na - nb + 1 words, 'r' holds nb words.  Neither may alias an operand.
+        template<typename N> void div_qr(N* q, N* r, const N* a, Size na, const N* b, Size nb);
+
+        /********************************************************************************************/
+        //
+        //                                  Kernel Dispatch
+        //
+        //        Where the limbs are 64 bit words on x86-64, the kernels of the table below are
+        //        built for several instruction sets, and the best variant the processor supports
+        //        is chosen at startup.  The environment variable APM_LIMB_KERNELS may name the
+        //        variant to use instead, which is honored only if the processor supports it.
+        //
+        //        The overloads for 64 bit words are declared ahead of the kernel templates, so
+        //        every kernel, and each caller of one, calls through the table.  Define
+        //        APM_NO_DISPATCH to build the portable kernels alone.
+        //
+        /********************************************************************************************/
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(APM_NO_DISPATCH)
+#define APM_LIMB_DISPATCH
+#endif
+
+        struct Limb_Variant {
+
+            typedef std::uint64_t W;
+
+            const char* name;
+
+            W    (*add_n)   (W* r, const W* a, const W* b, Size n);
+            W    (*sub_n)   (W* r, const W* a, const W* b, Size n);
+            W    (*mul_1)   (W* r, const W* a, Size n, W b);
+            W    (*addmul_1)(W* r, const W* a, Size n, W b);
+            W    (*submul_1)(W* r, const W* a, Size n, W b);
+            W    (*lshift)  (W* r, const W* a, Size n, Size bits);
+            W    (*rshift)  (W* r, const W* a, Size n, Size bits);
+            void (*and_n)   (W* r, const W* a, const W* b, Size n);
+            void (*or_n)    (W* r, const W* a, const W* b, Size n);
+            void (*xor_n)   (W* r, const W* a, const W* b, Size n);
+            void (*com_n)   (W* r, const W* a, Size n);
+        };
+
+        const Limb_Variant&              limb_variant();                    // The variant in use.
+        std::vector<const Limb_Variant*> limb_variants();                   // Those the processor supports, the portable one first.
+        Boolean                          use_limb_variant(const Text& name);  // Switch variants, if the processor supports it.
+
+#ifdef APM_LIMB_DISPATCH
+
+        extern std::atomic<const Limb_Variant*> active_limb_variant;
+
+        inline const Limb_Variant& limb_variant() {
+            return *active_limb_variant.load(std::memory_order_relaxed);
+        }
+
+        inline std::uint64_t add_n(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b, Size n) {
+            return limb_variant().add_n(r, a, b, n);
+        }
+
+        inline std::uint64_t sub_n(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b, Size n) {
+            return limb_variant().sub_n(r, a, b, n);
+        }
+
+        inline std::uint64_t mul_1(std::uint64_t* r, const std::uint64_t* a, Size n, std::uint64_t b) {
+            return limb_variant().mul_1(r, a, n, b);
+        }
+
+        inline std::uint64_t addmul_1(std::uint64_t* r, const std::uint64_t* a, Size n, std::uint64_t b) {
+            return limb_variant().addmul_1(r, a, n, b);
+        }
+
+        inline std::uint64_t submul_1(std::uint64_t* r, const std::uint64_t* a, Size n, std::uint64_t b) {
+            return limb_variant().submul_1(r, a, n, b);
+        }
+
+        inline std::uint64_t lshift(std::uint64_t* r, const std::uint64_t* a, Size n, Size bits) {
+            return limb_variant().lshift(r, a, n, bits);
+        }
+
+        inline std::uint64_t rshift(std::uint64_t* r, const std::uint64_t* a, Size n, Size bits) {
+            return limb_variant().rshift(r, a, n, bits);
+        }
+
+        inline void and_n(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b, Size n) {
+            limb_variant().and_n(r, a, b, n);
+        }
+
+        inline void or_n(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b, Size n) {
+            limb_variant().or_n(r, a, b, n);
+        }
+
+        inline void xor_n(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b, Size n) {
+            limb_variant().xor_n(r, a, b, n);
+        }
+
+        inline void com_n(std::uint64_t* r, const std::uint64_t* a, Size n) {
+            limb_variant().com_n(r, a, n);
+        }
+
+#endif
+
+        /********************************************************************************************/
+        //
+        //                              Single Word Implementation
+        //
+        /********************************************************************************************/
+
+        template<typename N>
+        constexpr Size lead_zeros(N a) {
+            return static_cast<Size>(std::countl_zero(a));
+        }
+
+        template<typename N>
+        constexpr N mul_wide(N a, N b, N& hi) {
+
+            typedef Limb_Traits<N> T;
+
+            if constexpr (T::HAS_DOUBLE) {
+
+                typename T::Double n = static_cast<typename T::Double>(a) * b;
+
+                hi = static_cast<N>(n >> T::BITS);
+
+                return static_cast<N>(n);
+            }
+            else {
+#if defined(_MSC_VER) && defined(_M_X64)
+                if constexpr (T::BITS == 64) {
+
+                    if (!std::is_constant_evaluated()) {
+
+                        unsigned __int64 h;
+                        N lo = _umul128(a, b, &h);
+
+                        hi = static_cast<N>(h);
+
+                        return lo;
+                    }
+                }
+#endif
+                // Schoolbook product of the half words.
+                N a0 = a & T::LOW, a1 = a >> T::HALF;
+                N b0 = b & T::LOW, b1 = b >> T::HALF;
+
+                N p00 = a0 * b0;
+                N p01 = a0 * b1;
+                N p10 = a1 * b0;
+                N p11 = a1 * b1;
+
+                N mid = (p00 >> T::HALF) + (p01 & T::LOW) + (p10 & T::LOW);
+
+                hi = p11 + (p01 >> T::HALF) + (p10 >> T::HALF) + (mid >> T::HALF);
+
+                return (mid << T::HALF) | (p00 & T::LOW);
+            }
+        }
+
+        template<typename N>
+        constexpr N div_wide(N hi, N lo, N d, N& rem) {
+
+            typedef Limb_Traits<N> T;
+
+            if constexpr (T::HAS_DOUBLE) {
+
+                typename T::Double n = (static_cast<typename T::Double>(hi) << T::BITS) | lo;
+
+                rem = static_cast<N>(n % d);
+
+                return static_cast<N>(n / d);
+            }
+            else {
+#if defined(_MSC_VER) && defined(_M_X64) && _MSC_VER >= 1920
+                if constexpr (T::BITS == 64) {
+
+                    if (!std::is_constant_evaluated()) {
+
+                        unsigned __int64 r;
+                        N q = _udiv128(hi, lo, d, &r);
+
+                        rem = static_cast<N>(r);
+
+                        return q;
+                    }
+                }
+#endif
+                /*
+                    Normalize the divisor, then produce the quotient one half word
+                    at a time, correcting each estimate (Hacker's Delight, divlu).
+                */
+                const N base = N(1) << T::HALF;
+
+                Size s = lead_zeros(d);
+
+                d <<= s;
+
+                N vn1 = d >> T::HALF;
+                N vn0 = d & T::LOW;
+
+                N un32 = s ? (hi << s) | (lo >> (T::BITS - s)) : hi;
+                N un10 = lo << s;
+
+                N un1 = un10 >> T::HALF;
+                N un0 = un10 & T::LOW;
+
+                N q1   = un32 / vn1;
+                N rhat = un32 - q1 * vn1;
+
+                while (q1 >= base || q1 * vn0 > ((rhat << T::HALF) | un1)) {
+
+                    q1   -= 1;
+                    rhat += vn1;
+
+                    if (rhat >= base) {
+                        break;
+                    }
+                }
+
+                N un21 = (un32 << T::HALF) + un1 - q1 * d;
+
+                N q0 = un21 / vn1;
+                rhat = un21 - q0 * vn1;
+
+                while (q0 >= base || q0 * vn0 > ((rhat << T::HALF) | un0)) {
+
+                    q0   -= 1;
+                    rhat += vn1;
+
+                    if (rhat >= base) {
+                        break;
+                    }
+                }
+
+                rem = ((un21 << T::HALF) + un0 - q0 * d) >> s;
+
+                return (q1 << T::HALF) | q0;
+            }
+        }
+
+        /********************************************************************************************/
+        //
+        //                              Limb Vector Implementation
+        //
+        /********************************************************************************************/
+
+        template<typename N>
+        constexpr sys_int cmp_n(const N* a, const N* b, Size n) {
+
+            while (n-- > 0) {
+
+                if (a[n] != b[n]) {
+                    return a[n] > b[n] ? 1 : -1;
+                }
+            }
+
+            return 0;
+        }
+
+        template<typename N>
+        constexpr N add_n(N* r, const N* a, const N* b, Size n) {
+
+            N carry = 0;
+
+            for (Size i = 0; i < n; i += 1) {
+
+                N s = a[i] + carry;
+                carry = s < carry;
+
+                N t = s + b[i];
+                carry += t < s;
+
+                r[i] = t;
+            }
+
+            return carry;
+        }
+
+        template<typename N>
+        constexpr N add_1(N* r, const N* a, Size n, N b) {
+
+            for (Size i = 0; i < n; i += 1) {
+
+                N s = a[i] + b;
+                b = s < b;
+
+                r[i] = s;
+            }
+
+            return b;
+        }
+
+        template<typename N>
+        constexpr N sub_n(N* r, const N* a, const N* b, Size n) {
+
+            N borrow = 0;
+
+            for (Size i = 0; i < n; i += 1) {
+
+                N s = b[i] + borrow;
+                borrow = s < borrow;
+
+                N t = a[i];
+                borrow += t < s;
+
+                r[i] = t - s;
+            }
+
+            return borrow;
+        }
+
+        template<typename N>
+        constexpr N sub_1(N* r, const N* a, Size n, N b) {
+
+            for (Size i = 0; i < n; i += 1) {
+
+                N t = a[i];
+
+                r[i] = t - b;
+                b = t < b;
+            }
+
+            return b;
+        }
+
+        template<typename N>
+        constexpr N mul_1(N* r, const N* a, Size n, N b) {
+
+            N carry = 0;
+
+            for (Size i = 0; i < n; i += 1) {
+
+                N hi;
+                N lo = mul_wide(a[i], b, hi);
+
+                lo += carry;
+                carry = hi + (lo < carry);
+
+                r[i] = lo;
+            }
+
+            return carry;
+        }
+
+        template<typename N>
+        constexpr N addmul_1(N* r, const N* a, Size n, N b) {
+
+            N carry = 0;
+
+            for (Size i = 0; i < n; i += 1) {
+
+                N hi;
+                N lo = mul_wide(a[i], b, hi);
+
+                lo += carry;
+                hi += lo < carry;
+
+                N t = r[i] + lo;
+                hi += t < lo;
+
+                r[i] = t;
+                carry = hi;
+            }
+
+            return carry;
+        }
+
+        template<typename N>
+        constexpr N submul_1(N* r, const N* a, Size n, N b) {
+
+            N borrow = 0;
+
+            for (Size i = 0; i < n; i += 1) {
+
+                N hi;
+                N lo = mul_wide(a[i], b, hi);
+
+                lo += borrow;
+                hi += lo < borrow;
+
+                N t = r[i];
+                hi += t < lo;
+
+                r[i] = t - lo;
+                borrow = hi;
+            }
+
+            return borrow;
+        }
+
+        template<typename N>
+        constexpr N lshift(N* r, const N* a, Size n, Size bits) {
+
+            if (n == 0) {
+                return 0;
+            }
+
+            if (bits == 0) {
+
+                for (Size i = n; i-- > 0;) {
+                    r[i] = a[i];
+                }
+
+                return 0;
+            }
+
+            const Size inv = Limb_Traits<N>::BITS - bits;
+
+            N out = a[n - 1] >> inv;
+
+            for (Size i = n - 1; i > 0; i -= 1) {
+                r[i] = (a[i] << bits) | (a[i - 1] >> inv);
+            }
+
+            r[0] = a[0] << bits;
+
+            return out;
+        }
+
+        template<typename N>
+        constexpr N rshift(N* r, const N* a, Size n, Size bits) {
+
+            if (n == 0) {
+                return 0;
+            }
+
+            if (bits == 0) {
+
+                for (Size i = 0; i < n; i += 1) {
+                    r[i] = a[i];
+                }
+
+                return 0;
+            }
+
+            const Size inv = Limb_Traits<N>::BITS - bits;
+
+            N out = a[0] << inv;
+
+            for (Size i = 0; i + 1 < n; i += 1) {
+                r[i] = (a[i] >> bits) | (a[i + 1] << inv);
+            }
+
+            r[n - 1] = a[n - 1] >> bits;
+
+            return out;
+        }
+
+        template<typename N>
+        constexpr N divrem_1(N* q, const N* a, Size n, N d) {
+
+            N rem = 0;
+
+            for (Size i = n; i-- > 0;) {
+                q[i] = div_wide(rem, a[i], d, rem);
+            }
+
+            return rem;
+        }
+
+        template<typename N>
+        constexpr N reciprocal_word(N d) {
+
+            N rem = 0;
+
+            return div_wide(static_cast<N>(~d), static_cast<N>(~N(0)), d, rem);
+        }
+
+        template<typename N>
+        constexpr N div_preinv(N hi, N lo, N d, N v, N& rem) {
+            /*
+                The quotient estimate v * hi + (hi + 1) * B + lo is at most one too small, or
+                one too large, and the remainder taken modulo B tells which.
+            */
+
+            N q1 = 0;
+            N q0 = mul_wide(v, hi, q1);
+
+            q0 = static_cast<N>(q0 + lo);
+            q1 = static_cast<N>(q1 + hi + 1 + (q0 < lo ? 1 : 0));
+
+            N r = static_cast<N>(lo - q1 * d);
+
+            if (r > q0) {
+                q1 = static_cast<N>(q1 - 1);
+                r  = static_cast<N>(r + d);
+            }
+
+            if (r >= d) {
+                q1 = static_cast<N>(q1 + 1);
+                r  = static_cast<N>(r - d);
+            }
+
+            rem = r;
+
+            return q1;
+        }
+
+        template<typename N>
+        constexpr N divrem_1_preinv(N* q, const N* a, Size n, N d, Size shift, N v) {
+            /*
+                The dividend is shifted alike as it is read, which leaves the quotient as it
+                is and the remainder shifted.  Each word is read before its quotient word is
+                written, so 'q' may alias 'a'.
+            */
+
+            typedef Limb_Traits<N> T;
+
+            if (n == 0) {
+                return 0;
+            }
+
+            N rem = 0;
+
+            if (shift == 0) {
+
+                for (Size i = n; i-- > 0;) {
+                    q[i] = div_preinv(rem, a[i], d, v, rem);
+                }
+
+                return rem;
+            }
+
+            rem = static_cast<N>(a[n - 1] >> (T::BITS - shift));
+
+            for (Size i = n; i-- > 0;) {
+
+                N lo = static_cast<N>(a[i] << shift);
+
+                if (i > 0) {
+                    lo |= static_cast<N>(a[i - 1] >> (T::BITS - shift));
+                }
+
+                q[i] = div_preinv(rem, lo, d, v, rem);
+            }
+
+            return static_cast<N>(rem >> shift);
+        }
+
+        template<typename N>
+        constexpr void and_n(N* r, const N* a, const N* b, Size n) {
+
+            for (Size i = 0; i < n; i += 1) {
+                r[i] = a[i] & b[i];
+            }
+        }
+
+        template<typename N>
+        constexpr void or_n(N* r, const N* a, const N* b, Size n) {
+
+            for (Size i = 0; i < n; i += 1) {
+                r[i] = a[i] | b[i];
+            }
+        }
+
+        template<typename N>
+        constexpr void xor_n(N* r, const N* a, const N* b, Size n) {
+
+            for (Size i = 0; i < n; i += 1) {
+                r[i] = a[i] ^ b[i];
+            }
+        }
+
+        template<typename N>
+        constexpr void com_n(N* r, const N* a, Size n) {
+
+            for (Size i = 0; i < n; i += 1) {
+                r[i] = ~a[i];
+            }
+        }
+
+        template<typename N>
+        inline void mul_basecase(N* r, const N* a, Size na, const N* b, Size nb) {
+
+            r[na] = mul_1(r, a, na, b[0]);
+
+            for (Size j = 1; j < nb; j += 1) {
+                r[j + na] = addmul_1(r + j, a, na, b[j]);
+            }
+        }
+
+        inline Size mul_scratch(Size n) {
+
+            Size words = 0;
+
+            while (n >= KARATSUBA_THRESHOLD) {
+
+                n -= n / 2;
+
+                words += 6 * n + 1;
+            }
+
+            return words;
+        }
+
+        template<typename N>
+        inline void mul_karatsuba(N* r, const N* a, const N* b, Size n, N* t) {
+            /*
+                Split a = a1 * B^l + a0 and b = b1 * B^l + b0, with the high halves the
+                longer by at most a word.  The middle product is built from the low and
+                high products less (a1 - a0) * (b1 - b0), so three half length products
+                replace four, and the differences never carry out of their length.
+
+                Scratch 't' holds |a1 - a0|, |b1 - b0|, their product, and the middle
+                product, followed by the scratch of the recursion.
+            */
+
+            if (n < KARATSUBA_THRESHOLD) {
+                mul_basecase(r, a, n, b, n);
+                return;
+            }
+
+            const Size l = n / 2;
+            const Size h = n - l;
+
+            N* da   = t;
+            N* db   = t + h;
+            N* d    = t + 2 * h;
+            N* mid  = t + 4 * h;
+            N* next = t + 6 * h + 1;
+
+            auto difference = [l, h](N* r, const N* x) -> Boolean {
+                // r = |x1 - x0|, returning whether x1 < x0.
+
+                const N* x0 = x;
+                const N* x1 = x + l;
+
+                Boolean less = (h == l || x1[l] == 0) && cmp_n(x1, x0, l) < 0;
+
+                if (less) {
+                    sub_n(r, x0, x1, l);
+                }
+                else {
+                    sub_1(r + l, x1 + l, h - l, sub_n(r, x1, x0, l));
+                }
+
+                if (less && h > l) {
+                    r[l] = 0;
+                }
+
+                return less;
+            };
+
+            Boolean negative = difference(da, a) != difference(db, b);
+
+            mul_karatsuba(d, da, db, h, next);
+
+            mul_karatsuba(r,         a,     b,     l, next);   // The low product.
+            mul_karatsuba(r + 2 * l, a + l, b + l, h, next);   // The high product.
+
+            // mid = low + high -/+ d, which is a0 * b1 + a1 * b0.
+            for (Size i = 0; i < 2 * h; i += 1) {
+                mid[i] = r[2 * l + i];
+            }
+
+            N carry = add_n(mid, mid, r, 2 * l);
+            mid[2 * h] = add_1(mid + 2 * l, mid + 2 * l, 2 * (h - l), carry);
+
+            if (negative) {
+                mid[2 * h] += add_n(mid, mid, d, 2 * h);
+            }
+            else {
+                mid[2 * h] -= sub_n(mid, mid, d, 2 * h);
+            }
+
+            carry = add_n(r + l, r + l, mid, 2 * h + 1);
+            add_1(r + l + 2 * h + 1, r + l + 2 * h + 1, l - 1, carry);
+        }
+
+        template<typename N>
+        inline void mul(N* r, const N* a, Size na, const N* b, Size nb) {
+            /*
+                An operand longer than the other is cut into pieces of the shorter
+                one's length, and each piece's product is added in at its offset.
+            */
+
+            if (nb < KARATSUBA_THRESHOLD) {
+                mul_basecase(r, a, na, b, nb);
+                return;
+            }
+
+            Limb_Vector<N> t(2 * nb + mul_scratch(nb));
+
+            N* piece   = t.data();
+            N* scratch = t.data() + 2 * nb;
+
+            mul_karatsuba(r, a, b, nb, scratch);
+
+            Size offset = nb;
+
+            for (; offset + nb <= na; offset += nb) {
+
+                mul_karatsuba(piece, a + offset, b, nb, scratch);
+
+                N carry = add_n(r + offset, r + offset, piece, nb);
+
+                for (Size i = nb; i < 2 * nb; i += 1) {
+                    r[offset + i] = piece[i];
+                }
+
+                add_1(r + offset + nb, r + offset + nb, nb, carry);
+            }
+
+            const Size rest = na - offset;
+
+            if (rest > 0) {
+
+                Limb_Vector<N> tail(nb + rest);
+
+                mul(tail.data(), b, nb, a + offset, rest);
+
+                N carry = add_n(r + offset, r + offset, tail.data(), nb);
+
+                for (Size i = nb; i < nb + rest; i += 1) {
+                    r[offset + i] = tail[i];
+                }
+
+                add_1(r + offset + nb, r + offset + nb, rest, carry);
+            }
+        }
+
+        template<typename N>
+        inline void mulhigh_n(N* r, const N* a, const N* b, Size n) {
+            /*
+                The partial products a[i] * b[j] with i + j >= n - 2 are summed exactly.  Those
+                left out total less than (n - 2) * B^(n - 1), under a unit of word n.
+
+                Split at l = (n - 1) / 2 words, a = a1 * B^l + a0 with a1 of k = n - l words.
+                The partial products kept are the full product a1 * b1, with the triangles of
+                a1 by b0 and of b1 by a0 whose i + j >= k - 2.  Those are again short products
+                of k words, b0 and a0 padded with zeros to k.  The products within a0 by b0 all
+                fall below word n - 2, and are left out.
+            */
+
+            if (n < SHORT_PRODUCT_THRESHOLD) {
+
+                Limb_Vector<N> w(2 * n, 0);
+
+                for (Size i = 0; i < n; i += 1) {
+
+                    Size j = (i + 2 < n) ? n - 2 - i : 0;
+
+                    w[i + n] = addmul_1(w.data() + i + j, b + j, n - j, a[i]);
+                }
+
+                for (Size i = 0; i < n + 2; i += 1) {
+                    r[i] = w[n - 2 + i];
+                }
+
+                return;
+            }
+
+            const Size l = (n - 1) / 2;
+            const Size k = n - l;
+            const Size s = l + 2 - k;                   // The word of 'r' that a1 * b1 starts at.
+
+            Limb_Vector<N> t(2 * k + 2, 0);
+
+            N* pad = t.data();                          // A low half, padded to k words.
+            N* tri = t.data() + k;                      // A triangle, of k + 2 words.
+
+            for (Size i = 0; i < s; i += 1) {
+                r[i] = 0;
+            }
+
+            mul(r + s, a + l, k, b + l, k);
+
+            for (Size i = 0; i < l; i += 1) {
+                pad[i] = b[i];
+            }
+
+            mulhigh_n(tri, a + l, pad, k);
+            add_1(r + k + 2, r + k + 2, n - k, add_n(r, r, tri, k + 2));
+
+            for (Size i = 0; i < l; i += 1) {
+                pad[i] = a[i];
+            }
+
+            mulhigh_n(tri, b + l, pad, k);
+            add_1(r + k + 2, r + k + 2, n - k, add_n(r, r, tri, k + 2));
+        }
+
+        template<typename N>
+        inline void mullow_n(N* r, const N* a, const N* b, Size n) {
+            /*
+                Split at l = n - n / 2 words, a = a1 * B^l + a0.  Modulo B^n the product is
+                a0 * b0, with a1 * b0 + a0 * b1 taken modulo B^(n - l) shifted up l words.
+            */
+
+            if (n < SHORT_PRODUCT_THRESHOLD) {
+
+                mul_1(r, b, n, a[0]);
+
+                for (Size i = 1; i < n; i += 1) {
+                    addmul_1(r + i, b, n - i, a[i]);
+                }
+
+                return;
+            }
+
+            const Size l = n - n / 2;
+            const Size h = n - l;
+
+            Limb_Vector<N> t(2 * l);
+
+            mul(t.data(), a, l, b, l);
+
+            for (Size i = 0; i < n; i += 1) {
+                r[i] = t[i];
+            }
+
+            mullow_n(t.data(), a + l, b, h);
+            add_n(r + l, r + l, t.data(), h);
+
+            mullow_n(t.data(), b + l, a, h);
+            add_n(r + l, r + l, t.data(), h);
+        }
+
+        template<typename N>
+        inline void div_qr(N* q, N* r, const N* a, Size na, const N* b, Size nb) {
+            /*
+                Knuth's algorithm D.  Both operands are normalized so the divisor's
+                leading bit is set, which bounds each quotient estimate to be at
+                most two greater than the true quotient word.
+            */
+            typedef Limb_Traits<N> T;
+
+            Size s = lead_zeros(b[nb - 1]);
+
+            Limb_Vector<N> vn(nb);
+            Limb_Vector<N> un(na + 1);
+
+            lshift(vn.data(), b, nb, s);
+            un[na] = lshift(un.data(), a, na, s);
+
+            const N v1 = vn[nb - 1];
+            const N v2 = vn[nb - 2];
+
+            for (Size j = na - nb + 1; j-- > 0;) {
+
+                N u2 = un[j + nb];
+                N u1 = un[j + nb - 1];
+                N u0 = un[j + nb - 2];
+
+                N qhat, rhat;
+
+                Boolean overflow = false;
+
+                if (u2 >= v1) {
+
+                    qhat = T::MASK;
+                    rhat = u1 + v1;
+
+                    overflow = rhat < u1;
+                }
+                else {
+                    qhat = div_wide(u2, u1, v1, rhat);
+                }
+
+                while (!overflow) {
+
+                    N hi;
+                    N lo = mul_wide(qhat, v2, hi);
+
+                    if (hi < rhat || (hi == rhat && lo <= u0)) {
+                        break;
+                    }
+
+                    qhat -= 1;
+                    rhat += v1;
+
+                    overflow = rhat < v1;
+                }
+
+                N borrow = submul_1(un.data() + j, vn.data(), nb, qhat);
+
+                N top = un[j + nb];
+                un[j + nb] = top - borrow;
+
+                if (top < borrow) {
+
+                    qhat -= 1;
+                    un[j + nb] += add_n(un.data() + j, un.data() + j, vn.data(), nb);
+                }
+
+                q[j] = qhat;
+            }
+
+            rshift(r, un.data(), nb, s);
+        }
+    }
+}
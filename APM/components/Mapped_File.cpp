@@ -0,0 +1,134 @@
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+
+#include "Mapped_File.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Olly {
+    namespace APM {
+
+#if defined(_WIN32)
+
+        Mapped_File::Mapped_File(const Text& path) : _data(nullptr), _size(0), _file(INVALID_HANDLE_VALUE), _mapping(nullptr) {
+
+            HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                      OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+            _file = file;
+
+            LARGE_INTEGER size;
+
+            if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+                return;
+            }
+
+            _mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+            if (_mapping) {
+                _data = static_cast<Char*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+            }
+
+            if (_data) {
+                _size = static_cast<Size>(size.QuadPart);
+
+                setg(_data, _data, _data + _size);
+            }
+        }
+
+        Mapped_File::~Mapped_File() {
+
+            if (_data) {
+                UnmapViewOfFile(_data);
+            }
+
+            if (_mapping) {
+                CloseHandle(_mapping);
+            }
+
+            if (_file != INVALID_HANDLE_VALUE) {
+                CloseHandle(_file);
+            }
+        }
+
+        Boolean Mapped_File::is_open() const {
+            return _file != INVALID_HANDLE_VALUE;
+        }
+
+#else
+
+        Mapped_File::Mapped_File(const Text& path) : _data(nullptr), _size(0), _file(-1) {
+
+            _file = open(path.c_str(), O_RDONLY);
+
+            struct stat info;
+
+            if (_file < 0 || fstat(_file, &info) != 0 || info.st_size == 0) {
+                return;
+            }
+
+            void* data = mmap(nullptr, static_cast<Size>(info.st_size), PROT_READ, MAP_PRIVATE, _file, 0);
+
+            if (data == MAP_FAILED) {
+                return;
+            }
+
+            madvise(data, static_cast<Size>(info.st_size), MADV_SEQUENTIAL);
+
+            _data = static_cast<Char*>(data);
+            _size = static_cast<Size>(info.st_size);
+
+            setg(_data, _data, _data + _size);
+        }
+
+        Mapped_File::~Mapped_File() {
+
+            if (_data) {
+                munmap(_data, _size);
+            }
+
+            if (_file >= 0) {
+                close(_file);
+            }
+        }
+
+        Boolean Mapped_File::is_open() const {
+            return _file >= 0;
+        }
+
+#endif
+
+        Size Mapped_File::size() const {
+            return _size;
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include <streambuf>
+#include "sys/config.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                              'Mapped_File' Class Declaration
+        //
+        //        A read only stream buffer over a file mapped into memory.  An istream built
+        //        on it reads the file in place, so 'read_digits' takes a number straight from
+        //        the mapped pages.  A file which cannot be opened reads as empty.
+        //
+        //            Mapped_File  file("digits.txt");
+        //            std::istream in(&file);
+        //            Whole_Number n = Whole_Number::read_digits(in);
+        //
+        /********************************************************************************************/
+
+        class Mapped_File : public std::streambuf {
+
+        public:
+
+            Mapped_File(const Text& path);
+            virtual ~Mapped_File();
+
+            Mapped_File(const Mapped_File& obj)            = delete;
+            Mapped_File& operator=(const Mapped_File& obj) = delete;
+
+            Boolean is_open() const;
+            Size    size()    const;
+
+        private:
+
+            Char* _data;
+            Size  _size;
+
+#if defined(_WIN32)
+            void* _file;        // The handles of the file and its mapping.
+            void* _mapping;
+#else
+            int   _file;        // The descriptor of the file.
+#endif
+        };
+    }
+}
@@ -0,0 +1,361 @@
+#pragma once
+
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include <atomic>
+#include <utility>
+#include "Instrument.h"
+#include "sys/config.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                              'Shared_Limbs' Class Declaration
+        //
+        //        The limb storage of a 'Binary_Register'.  Below SHARE_LIMBS limbs it is a plain
+        //        vector, copied deeply.  At or above it the limbs live in a reference counted
+        //        block, which a copy shares rather than duplicates.  Reading never copies; the
+        //        first write to a shared block gives the writer its own, so a uniquely owned
+        //        value is edited in place as before.
+        //
+        //        Only the members of 'std::vector' the register uses are provided.  The non-const
+        //        iterators and 'data()' take ownership first, so must be fetched before the write
+        //        they serve, never held across a copy of the value.
+        //
+        /********************************************************************************************/
+
+        template<typename N>
+        class Shared_Limbs {
+
+        public:
+            typedef Limb_Vector<N>                          Vector;
+            typedef typename Vector::iterator               iterator;
+            typedef typename Vector::const_iterator         const_iterator;
+            typedef typename Vector::const_reverse_iterator const_reverse_iterator;
+
+            static const Size SHARE_LIMBS = 64;     // The fewest limbs held in a shared block.
+
+            Shared_Limbs();
+            Shared_Limbs(Size size, N value);
+            ~Shared_Limbs();
+
+            Shared_Limbs(Shared_Limbs&& obj) noexcept;
+            Shared_Limbs(const Shared_Limbs& obj);
+            Shared_Limbs& operator=(const Shared_Limbs& obj);
+            Shared_Limbs& operator=(Shared_Limbs&& obj) noexcept;
+
+            Size    size()   const;
+            Boolean empty()  const;
+            Boolean shared() const;                 // Whether another value holds the same block.
+
+            N*       data();
+            const N* data() const;
+
+            N&       operator[](Size index);
+            const N& operator[](Size index) const;
+
+            const N& front() const;
+            const N& back()  const;
+
+            iterator       begin();
+            iterator       end();
+            const_iterator begin() const;
+            const_iterator end()   const;
+
+            const_iterator         cbegin()  const;
+            const_iterator         cend()    const;
+            const_reverse_iterator crbegin() const;
+            const_reverse_iterator crend()   const;
+
+            void push_back(N value);
+            void pop_back();
+            void resize(Size size, N value = 0);
+
+            iterator insert(const_iterator position, Size count, N value);
+            iterator erase (const_iterator first, const_iterator last);
+
+        private:
+
+            struct Block {
+                std::atomic<Size> refs;
+                Vector            limbs;
+            };
+
+            Vector _own;                            // The limbs while fewer than SHARE_LIMBS.
+            Block* _block;                          // Else the shared block, and '_own' is empty.
+
+            const Vector& limbs() const;
+            Vector&       edit();                   // The limbs, made unique to this value.
+
+            void promote();                         // Move into a block once large enough.
+            void release();
+        };
+
+        /********************************************************************************************/
+        //
+        //                              'Shared_Limbs' Class Definition
+        //
+        /********************************************************************************************/
+
+        template<typename N>
+        inline Shared_Limbs<N>::Shared_Limbs() : _own(), _block(nullptr) {
+        }
+
+        template<typename N>
+        inline Shared_Limbs<N>::Shared_Limbs(Size size, N value) : _own(size, value), _block(nullptr) {
+            promote();
+        }
+
+        template<typename N>
+        inline Shared_Limbs<N>::~Shared_Limbs() {
+            release();
+        }
+
+        template<typename N>
+        inline Shared_Limbs<N>::Shared_Limbs(Shared_Limbs&& obj) noexcept : _own(std::move(obj._own)), _block(obj._block) {
+
+            obj._own.clear();
+            obj._block = nullptr;
+        }
+
+        template<typename N>
+        inline Shared_Limbs<N>::Shared_Limbs(const Shared_Limbs& obj) : _own(obj._own), _block(obj._block) {
+
+            if (_block) {
+                _block->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        template<typename N>
+        inline Shared_Limbs<N>& Shared_Limbs<N>::operator=(const Shared_Limbs& obj) {
+
+            if (this != &obj) {
+
+                if (obj._block) {
+                    obj._block->refs.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                release();
+
+                _own   = obj._own;
+                _block = obj._block;
+            }
+
+            return *this;
+        }
+
+        template<typename N>
+        inline Shared_Limbs<N>& Shared_Limbs<N>::operator=(Shared_Limbs&& obj) noexcept {
+
+            if (this != &obj) {
+
+                release();
+
+                _own   = std::move(obj._own);
+                _block = obj._block;
+
+                obj._own.clear();
+                obj._block = nullptr;
+            }
+
+            return *this;
+        }
+
+        template<typename N>
+        inline Size Shared_Limbs<N>::size() const {
+            return limbs().size();
+        }
+
+        template<typename N>
+        inline Boolean Shared_Limbs<N>::empty() const {
+            return limbs().empty();
+        }
+
+        template<typename N>
+        inline Boolean Shared_Limbs<N>::shared() const {
+            return _block && _block->refs.load(std::memory_order_acquire) != 1;
+        }
+
+        template<typename N>
+        inline N* Shared_Limbs<N>::data() {
+            return edit().data();
+        }
+
+        template<typename N>
+        inline const N* Shared_Limbs<N>::data() const {
+            return limbs().data();
+        }
+
+        template<typename N>
+        inline N& Shared_Limbs<N>::operator[](Size index) {
+            return edit()[index];
+        }
+
+        template<typename N>
+        inline const N& Shared_Limbs<N>::operator[](Size index) const {
+            return limbs()[index];
+        }
+
+        template<typename N>
+        inline const N& Shared_Limbs<N>::front() const {
+            return limbs().front();
+        }
+
+        template<typename N>
+        inline const N& Shared_Limbs<N>::back() const {
+            return limbs().back();
+        }
+
+        template<typename N>
+        inline typename Shared_Limbs<N>::iterator Shared_Limbs<N>::begin() {
+            return edit().begin();
+        }
+
+        template<typename N>
+        inline typename Shared_Limbs<N>::iterator Shared_Limbs<N>::end() {
+            return edit().end();
+        }
+
+        template<typename N>
+        inline typename Shared_Limbs<N>::const_iterator Shared_Limbs<N>::begin() const {
+            return limbs().begin();
+        }
+
+        template<typename N>
+        inline typename Shared_Limbs<N>::const_iterator Shared_Limbs<N>::end() const {
+            return limbs().end();
+        }
+
+        template<typename N>
+        inline typename Shared_Limbs<N>::const_iterator Shared_Limbs<N>::cbegin() const {
+            return limbs().cbegin();
+        }
+
+        template<typename N>
+        inline typename Shared_Limbs<N>::const_iterator Shared_Limbs<N>::cend() const {
+            return limbs().cend();
+        }
+
+        template<typename N>
+        inline typename Shared_Limbs<N>::const_reverse_iterator Shared_Limbs<N>::crbegin() const {
+            return limbs().crbegin();
+        }
+
+        template<typename N>
+        inline typename Shared_Limbs<N>::const_reverse_iterator Shared_Limbs<N>::crend() const {
+            return limbs().crend();
+        }
+
+        template<typename N>
+        inline void Shared_Limbs<N>::push_back(N value) {
+
+            edit().push_back(value);
+
+            promote();
+        }
+
+        template<typename N>
+        inline void Shared_Limbs<N>::pop_back() {
+            edit().pop_back();
+        }
+
+        template<typename N>
+        inline void Shared_Limbs<N>::resize(Size size, N value) {
+
+            edit().resize(size, value);
+
+            promote();
+        }
+
+        template<typename N>
+        inline typename Shared_Limbs<N>::iterator Shared_Limbs<N>::insert(const_iterator position, Size count, N value) {
+
+            /*  The position must come from this value's own limbs, as 'begin()' gives once
+                ownership is taken, so 'edit()' below cannot move them.  */
+
+            Vector& v = edit();
+
+            Size index = position - v.cbegin();
+
+            v.insert(position, count, value);
+
+            promote();
+
+            return edit().begin() + index;
+        }
+
+        template<typename N>
+        inline typename Shared_Limbs<N>::iterator Shared_Limbs<N>::erase(const_iterator first, const_iterator last) {
+            return edit().erase(first, last);
+        }
+
+        template<typename N>
+        inline const typename Shared_Limbs<N>::Vector& Shared_Limbs<N>::limbs() const {
+            return _block ? _block->limbs : _own;
+        }
+
+        template<typename N>
+        inline typename Shared_Limbs<N>::Vector& Shared_Limbs<N>::edit() {
+
+            if (!_block) {
+                return _own;
+            }
+
+            if (_block->refs.load(std::memory_order_acquire) != 1) {
+
+                Block* block = new Block{ {1}, _block->limbs };
+
+                release();
+
+                _block = block;
+            }
+
+            return _block->limbs;
+        }
+
+        template<typename N>
+        inline void Shared_Limbs<N>::promote() {
+
+            if (!_block && _own.size() >= SHARE_LIMBS) {
+
+                _block = new Block{ {1}, std::move(_own) };
+
+                _own.clear();
+            }
+        }
+
+        template<typename N>
+        inline void Shared_Limbs<N>::release() {
+
+            if (_block && _block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete _block;
+            }
+
+            _block = nullptr;
+        }
+    }
+}
@@ -0,0 +1,129 @@
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include "Thread_Pool.h"
+
+namespace Olly {
+    namespace APM {
+
+        static thread_local Boolean pool_worker = false;
+
+        Thread_Pool& Thread_Pool::shared() {
+
+            static Thread_Pool pool([]() -> Size {
+
+                Size threads = std::thread::hardware_concurrency();
+
+                return (threads > 1) ? threads - 1 : 0;
+            }());
+
+            return pool;
+        }
+
+        Boolean Thread_Pool::is_worker() {
+            return pool_worker;
+        }
+
+        Thread_Pool::Thread_Pool(Size workers) : _workers(), _tasks(), _lock(), _wake(), _stop(false) {
+            start(workers);
+        }
+
+        Thread_Pool::~Thread_Pool() {
+            stop();
+        }
+
+        Size Thread_Pool::size() const {
+            return _workers.size() + 1;
+        }
+
+        void Thread_Pool::resize(Size workers) {
+
+            if (workers != _workers.size()) {
+                stop();
+                start(workers);
+            }
+        }
+
+        void Thread_Pool::start(Size workers) {
+
+            _stop = false;
+
+            _workers.reserve(workers);
+
+            for (Size i = 0; i < workers; ++i) {
+                _workers.emplace_back(&Thread_Pool::work, this);
+            }
+        }
+
+        void Thread_Pool::stop() {
+            {
+                std::lock_guard<std::mutex> hold(_lock);
+
+                _stop = true;
+            }
+
+            _wake.notify_all();
+
+            for (auto& worker : _workers) {
+                worker.join();
+            }
+
+            _workers.clear();
+        }
+
+        void Thread_Pool::submit(std::function<void()> task) {
+            {
+                std::lock_guard<std::mutex> hold(_lock);
+
+                _tasks.push_back(std::move(task));
+            }
+
+            _wake.notify_one();
+        }
+
+        void Thread_Pool::work() {
+
+            pool_worker = true;
+
+            while (true) {
+
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> hold(_lock);
+
+                    _wake.wait(hold, [this]() { return _stop || !_tasks.empty(); });
+
+                    if (_tasks.empty()) {
+                        return;
+                    }
+
+                    task = std::move(_tasks.front());
+                    _tasks.pop_front();
+                }
+
+                task();
+            }
+        }
+    }
+}
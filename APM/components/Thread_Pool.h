@@ -0,0 +1,139 @@
+#pragma once
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "sys/config.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                              'Thread_Pool' Class Declaration
+        //
+        //        A fixed set of worker threads which run the blocks of a 'parallel_for'.  The
+        //        calling thread runs the first block itself, so a pool of no workers simply runs
+        //        the loop in place.  A 'parallel_for' issued from a worker also runs in place,
+        //        so nested parallel work cannot wait on blocks queued behind itself.
+        //
+        /********************************************************************************************/
+
+        class Thread_Pool {
+
+        public:
+
+            static Thread_Pool& shared();               // One worker per spare hardware thread.
+
+            static Boolean is_worker();                 // Whether the calling thread is a pool worker.
+
+            Thread_Pool(Size workers);
+            virtual ~Thread_Pool();
+
+            Thread_Pool(const Thread_Pool& obj)            = delete;
+            Thread_Pool& operator=(const Thread_Pool& obj) = delete;
+
+            Size size() const;                          // The threads a loop splits across, the caller included.
+            void resize(Size workers);                  // Only while no loop is running on the pool.
+
+            template<typename F>
+            void parallel_for(Size count, Size grain, F body);  // Call body(begin, end) over blocks of [0, count),
+                                                                // each of at least 'grain' items.
+        private:
+
+            std::vector<std::thread>          _workers;
+            std::deque<std::function<void()>> _tasks;
+            std::mutex                        _lock;
+            std::condition_variable           _wake;
+            Boolean                           _stop;
+
+            void start(Size workers);
+            void stop();
+
+            void submit(std::function<void()> task);
+            void work();
+        };
+
+        template<typename F>
+        inline void Thread_Pool::parallel_for(Size count, Size grain, F body) {
+
+            Size blocks = (grain > 0) ? count / grain : count;
+
+            blocks = (blocks < size()) ? blocks : size();
+
+            if (blocks <= 1 || is_worker()) {
+                body(0, count);
+                return;
+            }
+
+            std::mutex              lock;
+            std::condition_variable done;
+            std::exception_ptr      error;
+            Size                    pending = blocks - 1;
+
+            auto run = [&](Size block) {
+
+                try {
+                    body(count * block / blocks, count * (block + 1) / blocks);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> hold(lock);
+
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            };
+
+            for (Size block = 1; block < blocks; ++block) {
+
+                submit([&, block]() {
+
+                    run(block);
+
+                    std::lock_guard<std::mutex> hold(lock);
+
+                    if (--pending == 0) {
+                        done.notify_one();
+                    }
+                });
+            }
+
+            run(0);
+
+            std::unique_lock<std::mutex> hold(lock);
+
+            done.wait(hold, [&pending]() { return pending == 0; });
+
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+}
@@ -0,0 +1,284 @@
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include <algorithm>
+#include "Batch.h"
+#include "../Thread_Pool.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                              'Decimal_Batch' Class Definition
+        //
+        //        The context of the calling thread, captured once for a batch.  The worker
+        //        threads have contexts of their own, so the kernels only use these settings.
+        //
+        /********************************************************************************************/
+
+        class Decimal_Batch {
+
+        public:
+
+            typedef Decimal::ROUNDING_MODE ROUNDING_MODE;
+
+            const Size          scale;
+            const Integer&      denominator;
+            const Divisor&      divisor;
+            const ROUNDING_MODE mode;
+
+            Decimal_Batch()
+                : scale(Decimal::decimal_scale()), denominator(Decimal::denominator()), divisor(Decimal::divisor()),
+                  mode(Decimal::round_mode()) {
+            }
+
+            const Integer& number(const Decimal& x, Integer& scratch) const {
+                /*
+                    The number of 'x' at the scale of the batch.  Only a number held at
+                    another scale is rescaled, into the scratch value.
+                */
+
+                if (x._scale == scale) {
+                    return x._number;
+                }
+
+                if (x._scale < scale) {
+                    scratch = x._number * Decimal::denominator(scale - x._scale);
+                }
+                else {
+                    scratch = Decimal::divide(x._number, Decimal::denominator(x._scale - scale), mode);
+                }
+
+                return scratch;
+            }
+
+            Integer divide(const Integer& n) const {
+                return Decimal::divide(n, divisor, mode);
+            }
+
+            Decimal make(Integer&& n) const {
+
+                Decimal a;
+
+                a._number = std::move(n);
+                a._scale  = scale;
+
+                return a;
+            }
+        };
+
+        static Size batch_size(Size a, Size b, Size c) {
+            return std::min(a, std::min(b, c));
+        }
+
+        void add_n(std::span<const Integer> a, std::span<const Integer> b, std::span<Integer> result) {
+
+            Thread_Pool::shared().parallel_for(batch_size(a.size(), b.size(), result.size()), BATCH_GRAIN,
+                [&](Size begin, Size end) {
+
+                    for (Size i = begin; i < end; ++i) {
+                        result[i] = a[i] + b[i];
+                    }
+                });
+        }
+
+        void mul_n(std::span<const Integer> a, std::span<const Integer> b, std::span<Integer> result) {
+
+            Thread_Pool::shared().parallel_for(batch_size(a.size(), b.size(), result.size()), BATCH_GRAIN,
+                [&](Size begin, Size end) {
+
+                    for (Size i = begin; i < end; ++i) {
+                        result[i] = a[i] * b[i];
+                    }
+                });
+        }
+
+        void scale_n(std::span<const Integer> a, const Integer& c, std::span<Integer> result) {
+
+            Thread_Pool::shared().parallel_for(std::min(a.size(), result.size()), BATCH_GRAIN,
+                [&](Size begin, Size end) {
+
+                    for (Size i = begin; i < end; ++i) {
+                        result[i] = a[i] * c;
+                    }
+                });
+        }
+
+        Integer sum(std::span<const Integer> a) {
+
+            Integer    total;
+            std::mutex lock;
+
+            Thread_Pool::shared().parallel_for(a.size(), BATCH_GRAIN, [&](Size begin, Size end) {
+
+                Integer partial;
+
+                for (Size i = begin; i < end; ++i) {
+                    partial += a[i];
+                }
+
+                std::lock_guard<std::mutex> hold(lock);
+
+                total += partial;
+            });
+
+            return total;
+        }
+
+        Integer dot(std::span<const Integer> a, std::span<const Integer> b) {
+
+            Integer    total;
+            std::mutex lock;
+
+            Thread_Pool::shared().parallel_for(std::min(a.size(), b.size()), BATCH_GRAIN, [&](Size begin, Size end) {
+
+                Integer partial;
+
+                for (Size i = begin; i < end; ++i) {
+                    partial += a[i] * b[i];
+                }
+
+                std::lock_guard<std::mutex> hold(lock);
+
+                total += partial;
+            });
+
+            return total;
+        }
+
+        void add_n(std::span<const Decimal> a, std::span<const Decimal> b, std::span<Decimal> result) {
+
+            const Decimal_Batch batch;
+
+            Thread_Pool::shared().parallel_for(batch_size(a.size(), b.size(), result.size()), BATCH_GRAIN,
+                [&](Size begin, Size end) {
+
+                    Integer x, y;
+
+                    for (Size i = begin; i < end; ++i) {
+                        result[i] = batch.make(batch.number(a[i], x) + batch.number(b[i], y));
+                    }
+                });
+        }
+
+        void mul_n(std::span<const Decimal> a, std::span<const Decimal> b, std::span<Decimal> result) {
+
+            const Decimal_Batch batch;
+
+            Thread_Pool::shared().parallel_for(batch_size(a.size(), b.size(), result.size()), BATCH_GRAIN,
+                [&](Size begin, Size end) {
+
+                    Integer x, y;
+
+                    for (Size i = begin; i < end; ++i) {
+                        result[i] = batch.make(batch.divide(batch.number(a[i], x) * batch.number(b[i], y)));
+                    }
+                });
+        }
+
+        void scale_n(std::span<const Decimal> a, const Decimal& c, std::span<Decimal> result) {
+            /*
+                A whole valued factor multiplies the numbers exactly, without the
+                division back to the scale each product would otherwise need.
+            */
+
+            const Decimal_Batch batch;
+
+            Integer factor, scratch;
+            factor = batch.number(c, scratch);
+
+            Integer whole, fraction;
+            factor.div_rem(batch.denominator, whole, fraction);
+
+            const Boolean exact = factor.is_defined() && !fraction.is();
+
+            Thread_Pool::shared().parallel_for(std::min(a.size(), result.size()), BATCH_GRAIN,
+                [&](Size begin, Size end) {
+
+                    Integer x;
+
+                    for (Size i = begin; i < end; ++i) {
+
+                        if (exact) {
+                            result[i] = batch.make(batch.number(a[i], x) * whole);
+                        }
+                        else {
+                            result[i] = batch.make(batch.divide(batch.number(a[i], x) * factor));
+                        }
+                    }
+                });
+        }
+
+        Decimal sum(std::span<const Decimal> a) {
+
+            const Decimal_Batch batch;
+
+            Integer    total;
+            std::mutex lock;
+
+            Thread_Pool::shared().parallel_for(a.size(), BATCH_GRAIN, [&](Size begin, Size end) {
+
+                Integer partial, x;
+
+                for (Size i = begin; i < end; ++i) {
+                    partial += batch.number(a[i], x);
+                }
+
+                std::lock_guard<std::mutex> hold(lock);
+
+                total += partial;
+            });
+
+            return batch.make(std::move(total));
+        }
+
+        Decimal dot(std::span<const Decimal> a, std::span<const Decimal> b) {
+            /*
+                The products are summed at twice the scale, so the one division
+                back to the scale is the only rounding.
+            */
+
+            const Decimal_Batch batch;
+
+            Integer    total;
+            std::mutex lock;
+
+            Thread_Pool::shared().parallel_for(std::min(a.size(), b.size()), BATCH_GRAIN, [&](Size begin, Size end) {
+
+                Integer partial, x, y;
+
+                for (Size i = begin; i < end; ++i) {
+                    partial += batch.number(a[i], x) * batch.number(b[i], y);
+                }
+
+                std::lock_guard<std::mutex> hold(lock);
+
+                total += partial;
+            });
+
+            return batch.make(batch.divide(total));
+        }
+    }
+}
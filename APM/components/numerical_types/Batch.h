@@ -0,0 +1,60 @@
+#pragma once
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include <span>
+#include "Integer.h"
+#include "Decimal.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                                  Batch Kernels
+        //
+        //        Element-wise and reducing operations over spans of numbers.  The element-wise
+        //        kernels cover the shortest of their spans.  The context of the calling thread
+        //        is read once per call, and a span of at least 'BATCH_GRAIN' * 2 elements is
+        //        split across the shared 'Thread_Pool'.  Each block reuses its own scratch values.
+        //
+        //        'sum' and 'dot' over Decimals accumulate exactly, and round once at the end.
+        //
+        /********************************************************************************************/
+
+        static const Size BATCH_GRAIN = 512;    // The fewest elements a thread is handed.
+
+        void    add_n  (std::span<const Integer> a, std::span<const Integer> b, std::span<Integer> result);
+        void    mul_n  (std::span<const Integer> a, std::span<const Integer> b, std::span<Integer> result);
+        void    scale_n(std::span<const Integer> a, const Integer& c,           std::span<Integer> result);
+        Integer sum    (std::span<const Integer> a);
+        Integer dot    (std::span<const Integer> a, std::span<const Integer> b);
+
+        void    add_n  (std::span<const Decimal> a, std::span<const Decimal> b, std::span<Decimal> result);
+        void    mul_n  (std::span<const Decimal> a, std::span<const Decimal> b, std::span<Decimal> result);
+        void    scale_n(std::span<const Decimal> a, const Decimal& c,           std::span<Decimal> result);
+        Decimal sum    (std::span<const Decimal> a);
+        Decimal dot    (std::span<const Decimal> a, std::span<const Decimal> b);
+    }
+}
@@ -0,0 +1,582 @@
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include <cmath>
+#include "Big_Float.h"
+#include "Power_Cache.h"
+
+namespace Olly {
+    namespace APM {
+
+        static Size bit_length(const Whole_Number& n) {
+            return n.is() ? n.get_Binary_Register().lead_bit() : 0;
+        }
+
+        static Integer with_sign(const Whole_Number& n, Boolean negative) {
+
+            Integer a(n);
+
+            return negative ? -a : a;
+        }
+
+        Size Big_Float::precision() {
+
+            Size digits = Decimal_Context::current().precision();
+
+            return digits >= MIN_PRECISION ? digits : MIN_PRECISION;
+        }
+
+        void Big_Float::precision(const Size& digits) {
+            Decimal_Context::current().precision(digits >= MIN_PRECISION ? digits : MIN_PRECISION);
+        }
+
+        Size Big_Float::precision_bits() {
+            // log2(10) < 3.322, plus two bits so the last decimal digit is always held.
+            return (precision() * 3322) / 1000 + 2;
+        }
+
+        Big_Float::Big_Float() : _mantissa(), _exponent(0) {
+        }
+
+        Big_Float::Big_Float(sys_int value) : _mantissa(value), _exponent(0) {
+            normalize();
+        }
+
+        Big_Float::Big_Float(const Integer& value) : _mantissa(value), _exponent(0) {
+            normalize();
+        }
+
+        Big_Float::Big_Float(const Integer& mantissa, sys_int exponent) : _mantissa(mantissa), _exponent(exponent) {
+            normalize();
+        }
+
+        Big_Float::Big_Float(Text value) : _mantissa(), _exponent(0) {
+            set_text(value);
+        }
+
+        Big_Float::~Big_Float() {
+        }
+
+        Boolean Big_Float::is() const {
+            return _mantissa.is();
+        }
+
+        Boolean Big_Float::is_positive() const {
+            return _mantissa.is_positive();
+        }
+
+        Boolean Big_Float::is_negative() const {
+            return _mantissa.is_negative();
+        }
+
+        Boolean Big_Float::is_zero() const {
+            return _mantissa.is_zero();
+        }
+
+        Boolean Big_Float::is_undefined() const {
+            return _mantissa.is_undefined();
+        }
+
+        Boolean Big_Float::is_defined() const {
+            return _mantissa.is_defined();
+        }
+
+        Boolean Big_Float::is_nan() const {
+            return _mantissa.is_nan();
+        }
+
+        Boolean Big_Float::is_finite() const {
+            return _mantissa.is_finite();
+        }
+
+        Boolean Big_Float::is_infinite() const {
+            return _mantissa.is_infinite();
+        }
+
+        Boolean Big_Float::operator==(const Big_Float& b) const {
+            return compare(b) == 0;
+        }
+
+        Boolean Big_Float::operator!=(const Big_Float& b) const {
+            return compare(b) != 0;
+        }
+
+        Boolean Big_Float::operator>=(const Big_Float& b) const {
+            return compare(b) >= 0;
+        }
+
+        Boolean Big_Float::operator<=(const Big_Float& b) const {
+            return compare(b) <= 0;
+        }
+
+        Boolean Big_Float::operator>(const Big_Float& b) const {
+            return compare(b) > 0;
+        }
+
+        Boolean Big_Float::operator<(const Big_Float& b) const {
+            return compare(b) < 0;
+        }
+
+        sys_float Big_Float::compare(const Big_Float& b) const {
+
+            if (!is_finite() || !b.is_finite()) {
+                return _mantissa.compare(b._mantissa);
+            }
+
+            /*
+                A rounded difference is zero only when the exact difference is,
+                so its sign orders the two values.
+            */
+            Big_Float d = *this - b;
+
+            if (d.is_zero()) {
+                return 0.0;
+            }
+
+            return d.is_negative() ? -1.0 : 1.0;
+        }
+
+        Big_Float Big_Float::operator+() const {
+            return *this;
+        }
+
+        Big_Float Big_Float::operator-() const {
+
+            Big_Float a(*this);
+
+            a._mantissa = -a._mantissa;
+
+            return a;
+        }
+
+        Big_Float& Big_Float::operator+=(const Big_Float& b) {
+
+            if (!is_finite() || !b.is_finite()) {
+
+                _mantissa += b._mantissa;
+                _exponent = 0;
+
+                return *this;
+            }
+
+            if (b.is_zero()) {
+                return *this;
+            }
+
+            if (is_zero()) {
+                *this = b;
+                return *this;
+            }
+
+            /*
+                An operand lying wholly below the other's last rounded bit
+                cannot change the result, so skip aligning it.
+            */
+            sys_int prec  = static_cast<sys_int>(precision_bits());
+            sys_int top_a = static_cast<sys_int>(size_bits()) + _exponent;
+            sys_int top_b = static_cast<sys_int>(b.size_bits()) + b._exponent;
+
+            if (top_a - top_b > prec + 1) {
+                return *this;
+            }
+
+            if (top_b - top_a > prec + 1) {
+                *this = b;
+                return *this;
+            }
+
+            if (_exponent > b._exponent) {
+
+                Size shift = static_cast<Size>(_exponent - b._exponent);
+
+                _mantissa = with_sign(_mantissa.get_Whole_Number() << shift, is_negative());
+                _exponent = b._exponent;
+
+                _mantissa += b._mantissa;
+            }
+            else if (_exponent < b._exponent) {
+
+                Size shift = static_cast<Size>(b._exponent - _exponent);
+
+                _mantissa += with_sign(b._mantissa.get_Whole_Number() << shift, b.is_negative());
+            }
+            else {
+                _mantissa += b._mantissa;
+            }
+
+            normalize();
+
+            return *this;
+        }
+
+        Big_Float& Big_Float::operator-=(const Big_Float& b) {
+            return operator+=(-b);
+        }
+
+        Big_Float& Big_Float::operator*=(const Big_Float& b) {
+
+            _mantissa *= b._mantissa;
+            _exponent  = is_finite() ? _exponent + b._exponent : 0;
+
+            normalize();
+
+            return *this;
+        }
+
+        Big_Float& Big_Float::operator/=(const Big_Float& b) {
+
+            if (b.is_zero()) {
+
+                _mantissa = Integer::UNDEF;
+                _exponent = 0;
+
+                return *this;
+            }
+
+            if (!is_finite() || !b.is_finite()) {
+
+                _mantissa /= b._mantissa;
+                _exponent = 0;
+
+                return *this;
+            }
+
+            if (is_zero()) {
+                return *this;
+            }
+
+            /*
+                Scale the dividend so the quotient carries two bits beyond the
+                working precision, and fold any remainder into a sticky bit.
+            */
+            Size prec   = precision_bits();
+            Size bits_a = size_bits();
+            Size bits_b = b.size_bits();
+
+            Size shift = prec + 2 + bits_b > bits_a ? prec + 2 + bits_b - bits_a : 0;
+
+            Whole_Number q, r;
+            (_mantissa.get_Whole_Number() << shift).div_rem(b._mantissa.get_Whole_Number(), q, r);
+
+            if (r.is()) {
+                q <<= 1;
+                q |= Whole_Number(1);
+                shift += 1;
+            }
+
+            Boolean neg = is_negative() != b.is_negative();
+
+            _mantissa = with_sign(q, neg);
+            _exponent = _exponent - b._exponent - static_cast<sys_int>(shift);
+
+            normalize();
+
+            return *this;
+        }
+
+        Big_Float Big_Float::operator+(const Big_Float& b) const {
+
+            Big_Float a(*this);
+
+            a += b;
+
+            return a;
+        }
+
+        Big_Float Big_Float::operator-(const Big_Float& b) const {
+
+            Big_Float a(*this);
+
+            a -= b;
+
+            return a;
+        }
+
+        Big_Float Big_Float::operator*(const Big_Float& b) const {
+
+            Big_Float a(*this);
+
+            a *= b;
+
+            return a;
+        }
+
+        Big_Float Big_Float::operator/(const Big_Float& b) const {
+
+            Big_Float a(*this);
+
+            a /= b;
+
+            return a;
+        }
+
+        Big_Float Big_Float::abs() const {
+            return is_negative() ? operator-() : *this;
+        }
+
+        Big_Float Big_Float::pow(Size b) const {
+
+            Big_Float a = *this;
+            Big_Float res = 1;
+
+            while (b) {
+
+                if (b & 1) {
+                    res *= a;
+                }
+
+                b >>= 1;
+
+                if (b) {
+                    a *= a;
+                }
+            }
+
+            return res;
+        }
+
+        Text Big_Float::sign() const {
+            return _mantissa.sign();
+        }
+
+        Text Big_Float::to_string() const {
+
+            if (!is_finite()) {
+                return _mantissa.to_string();
+            }
+
+            if (is_zero()) {
+                return "0.0";
+            }
+
+            Whole_Number m = _mantissa.get_Whole_Number();
+
+            sys_int digits = static_cast<sys_int>(precision());
+            sys_int top    = static_cast<sys_int>(size_bits()) + _exponent;
+
+            // Estimate the decimal exponent of the leading digit, then correct it.
+            sys_int exp10 = static_cast<sys_int>(std::floor((top - 1) * 0.30102999566398120));
+
+            Whole_Number d;
+
+            while (true) {
+
+                sys_int k = digits - 1 - exp10;
+
+                Whole_Number num = m;
+                Whole_Number den = 1;
+
+                if (k >= 0) {
+                    num *= Power_Cache::power(10, static_cast<Size>(k));
+                }
+                else {
+                    den *= Power_Cache::power(10, static_cast<Size>(-k));
+                }
+
+                if (_exponent >= 0) {
+                    num <<= static_cast<Size>(_exponent);
+                }
+                else {
+                    den <<= static_cast<Size>(-_exponent);
+                }
+
+                Whole_Number r;
+                num.div_rem(den, d, r);
+
+                // Round half even.
+                sys_float c = (r << 1).compare(den);
+
+                if (c > 0 || (c == 0 && d.is_odd())) {
+                    d += 1;
+                }
+
+                if (d >= Power_Cache::power(10, static_cast<Size>(digits))) {
+                    exp10 += 1;
+                }
+                else if (d < Power_Cache::power(10, static_cast<Size>(digits - 1))) {
+                    exp10 -= 1;
+                }
+                else {
+                    break;
+                }
+            }
+
+            Text s = d.to_string(0);
+
+            while (s.size() > 1 && s.back() == '0') {
+                s.pop_back();
+            }
+
+            Text result = is_negative() ? "-" : "";
+
+            if (exp10 >= digits || exp10 <= -7) {
+
+                result += s.substr(0, 1) + "." + (s.size() > 1 ? s.substr(1) : "0");
+                result += "e" + std::to_string(exp10);
+            }
+            else if (exp10 >= 0) {
+
+                Size point = static_cast<Size>(exp10) + 1;
+
+                if (s.size() < point) {
+                    s.append(point - s.size(), '0');
+                }
+
+                result += s.substr(0, point) + "." + (s.size() > point ? s.substr(point) : "0");
+            }
+            else {
+                result += "0." + Text(static_cast<Size>(-exp10 - 1), '0') + s;
+            }
+
+            return result;
+        }
+
+        const Integer& Big_Float::get_mantissa() const {
+            return _mantissa;
+        }
+
+        sys_int Big_Float::get_exponent() const {
+            return _exponent;
+        }
+
+        void Big_Float::normalize() {
+
+            if (!_mantissa.is_finite() || _mantissa.is_zero()) {
+                _exponent = 0;
+                return;
+            }
+
+            Size bits = size_bits();
+            Size prec = precision_bits();
+
+            if (bits <= prec) {
+                return;
+            }
+
+            Size drop = bits - prec;
+
+            const Whole_Number& m = _mantissa.get_Whole_Number();
+
+            Whole_Number q = m >> drop;
+            Whole_Number r = m - (q << drop);
+
+            // Round half even on the dropped bits.
+            sys_float c = r.compare(Whole_Number(1) << (drop - 1));
+
+            if (c > 0 || (c == 0 && q.is_odd())) {
+
+                q += 1;
+
+                if (bit_length(q) > prec) {
+                    q >>= 1;
+                    drop += 1;
+                }
+            }
+
+            _mantissa  = with_sign(q, is_negative());
+            _exponent += static_cast<sys_int>(drop);
+        }
+
+        Size Big_Float::size_bits() const {
+            return bit_length(_mantissa.get_Whole_Number());
+        }
+
+        void Big_Float::set_text(Text& value) {
+
+            value = to_lower(trim(value));
+
+            Boolean neg = false;
+
+            if (!value.empty() && (value[0] == '-' || value[0] == '+')) {
+                neg = value[0] == '-';
+                value.erase(0, 1);
+            }
+
+            if (value == "infinity" || value == "undefined" || value == "nan") {
+
+                _mantissa = value == "nan" ? Integer::NaN : Integer((neg ? "-" : "") + value);
+
+                return;
+            }
+
+            // Split off a decimal exponent, then fold the fraction digits into it.
+            sys_int exp10 = 0;
+
+            auto found = value.find('e');
+
+            if (found != Text::npos) {
+                exp10 = to<sys_int>(value.substr(found + 1));
+                value.erase(found);
+            }
+
+            found = value.find('.');
+
+            if (found != Text::npos) {
+                exp10 -= static_cast<sys_int>(value.size() - found - 1);
+                value.erase(found, 1);
+            }
+
+            Boolean error = false;
+
+            Whole_Number digits(value, 10, error);
+
+            if (error || value.empty()) {
+                _mantissa = Integer::NaN;
+                return;
+            }
+
+            if (exp10 >= 0) {
+
+                _mantissa = with_sign(digits * Power_Cache::power(10, static_cast<Size>(exp10)), neg);
+
+                normalize();
+
+                return;
+            }
+
+            // Divide by the power of ten, keeping a sticky bit for the rounding.
+            Whole_Number den = Power_Cache::power(10, static_cast<Size>(-exp10));
+
+            Size prec   = precision_bits();
+            Size bits_a = bit_length(digits);
+            Size bits_b = bit_length(den);
+
+            Size shift = prec + 2 + bits_b > bits_a ? prec + 2 + bits_b - bits_a : 0;
+
+            Whole_Number q, r;
+            (digits << shift).div_rem(den, q, r);
+
+            if (r.is()) {
+                q <<= 1;
+                q |= Whole_Number(1);
+                shift += 1;
+            }
+
+            _mantissa = with_sign(q, neg);
+            _exponent = -static_cast<sys_int>(shift);
+
+            normalize();
+        }
+    }
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include "Integer.h"
+#include "Decimal_Context.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                              'Big_Float' Class Declaration
+        //
+        //        A binary floating point number valued _mantissa * 2^_exponent.  The mantissa
+        //        is rounded (half even) to the working precision after every operation, so a
+        //        product is a single multiplication plus a shift, and small values stay small.
+        //
+        /********************************************************************************************/
+
+        class Big_Float {
+
+        public:
+
+            static Size precision();                     // The working precision of the thread's context,
+                                                         // in decimal digits.
+            static void precision(const Size& digits);
+
+            Big_Float();
+            Big_Float(sys_int value);
+            Big_Float(const Integer& value);
+            Big_Float(const Integer& mantissa, sys_int exponent);
+            Big_Float(Text value);
+            virtual ~Big_Float();
+
+            Big_Float(Big_Float&& obj)                 = default;
+            Big_Float(const Big_Float& obj)            = default;
+            Big_Float& operator=(const Big_Float& obj) = default;
+            Big_Float& operator=(Big_Float&& obj)      = default;
+
+            Boolean is() const;
+
+            Boolean is_positive()  const;
+            Boolean is_negative()  const;
+            Boolean is_zero()      const;
+            Boolean is_undefined() const;
+            Boolean is_defined()   const;
+            Boolean is_nan()       const;
+            Boolean is_finite()    const;
+            Boolean is_infinite()  const;
+
+            Boolean operator==(const Big_Float& b) const;
+            Boolean operator!=(const Big_Float& b) const;
+            Boolean operator< (const Big_Float& b) const;
+            Boolean operator> (const Big_Float& b) const;
+            Boolean operator<=(const Big_Float& b) const;
+            Boolean operator>=(const Big_Float& b) const;
+
+            sys_float compare(const Big_Float& other) const;
+
+            Big_Float operator+() const;
+            Big_Float operator-() const;
+
+            Big_Float& operator+=(const Big_Float& b);
+            Big_Float& operator-=(const Big_Float& b);
+            Big_Float& operator*=(const Big_Float& b);
+            Big_Float& operator/=(const Big_Float& b);
+
+            Big_Float operator+(const Big_Float& b) const;
+            Big_Float operator-(const Big_Float& b) const;
+            Big_Float operator*(const Big_Float& b) const;
+            Big_Float operator/(const Big_Float& b) const;
+
+            Big_Float abs()       const;
+            Big_Float pow(Size b) const;
+
+            Text sign()      const;
+            Text to_string() const;
+
+            const Integer& get_mantissa() const;
+            sys_int        get_exponent() const;
+
+        private:
+
+            static const Size MIN_PRECISION = 8;
+
+            static Size precision_bits();
+
+            Integer _mantissa;
+            sys_int _exponent;
+
+            void normalize();                              // Round the mantissa to the working precision.
+            Size size_bits() const;                        // The bit length of the mantissa.
+
+            void set_text(Text& value);
+        };
+    }
+}
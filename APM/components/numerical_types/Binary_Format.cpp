@@ -0,0 +1,499 @@
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+
+#include <bit>
+#include <utility>
+#include "Binary_Format.h"
+
+namespace Olly {
+    namespace APM {
+
+        void Binary_Format::encode(const Whole_Number& a, Bytes& out) {
+
+            put_header(out, KIND::whole, static_cast<std::uint8_t>(a.is() ? Integer::SIGN::positive : Integer::SIGN::zero), 0);
+            put_magnitude(out, a);
+        }
+
+        void Binary_Format::encode(const Integer& a, Bytes& out) {
+
+            put_header(out, KIND::integer, sign_of(a), 0);
+            put_magnitude(out, a._number);
+        }
+
+        void Binary_Format::encode(const Rational& a, Bytes& out) {
+
+            put_header(out, KIND::rational, sign_of(a._numerator), 0);
+            put_magnitude(out, a._numerator._number);
+            put_magnitude(out, a._denominator);
+        }
+
+        void Binary_Format::encode(const Decimal& a, Bytes& out) {
+
+            put_header(out, KIND::decimal, sign_of(a._number), a._scale);
+            put_magnitude(out, a._number._number);
+        }
+
+        Size Binary_Format::decode(const std::uint8_t* data, Size size, Whole_Number& a) {
+
+            if (!check_header(data, size, KIND::whole)) {
+                return 0;
+            }
+
+            Size read = get_magnitude(data + 16, size - 16, a);
+
+            return read ? 16 + read : 0;
+        }
+
+        Size Binary_Format::decode(const std::uint8_t* data, Size size, Integer& a) {
+
+            if (!check_header(data, size, KIND::integer)) {
+                return 0;
+            }
+
+            Integer b;
+
+            Size read = get_magnitude(data + 16, size - 16, b._number);
+
+            if (!read || !set_sign(b, data[5])) {
+                return 0;
+            }
+
+            a = std::move(b);
+
+            return 16 + read;
+        }
+
+        Size Binary_Format::decode(const std::uint8_t* data, Size size, Rational& a) {
+
+            if (!check_header(data, size, KIND::rational)) {
+                return 0;
+            }
+
+            Rational b;
+
+            Size read = get_magnitude(data + 16, size - 16, b._numerator._number);
+
+            if (!read || !set_sign(b._numerator, data[5])) {
+                return 0;
+            }
+
+            Size den = get_magnitude(data + 16 + read, size - 16 - read, b._denominator);
+
+            if (!den || !b._denominator.is()) {
+                return 0;
+            }
+
+            a = std::move(b);
+
+            return 16 + read + den;
+        }
+
+        Size Binary_Format::decode(const std::uint8_t* data, Size size, Decimal& a) {
+
+            if (!check_header(data, size, KIND::decimal)) {
+                return 0;
+            }
+
+            Decimal b;
+
+            Size read = get_magnitude(data + 16, size - 16, b._number._number);
+
+            if (!read || !set_sign(b._number, data[5])) {
+                return 0;
+            }
+
+            b._scale = static_cast<Size>(get_word(data + 8));
+
+            a = std::move(b);
+
+            return 16 + read;
+        }
+
+        void Binary_Format::put_word(Bytes& out, std::uint64_t word) {
+
+            for (Size i = 0; i < 8; ++i) {
+                out.push_back(static_cast<std::uint8_t>(word >> (8 * i)));
+            }
+        }
+
+        std::uint64_t Binary_Format::get_word(const std::uint8_t* data) {
+
+            std::uint64_t word = 0;
+
+            for (Size i = 8; i-- > 0;) {
+                word = (word << 8) | data[i];
+            }
+
+            return word;
+        }
+
+        void Binary_Format::put_header(Bytes& out, KIND kind, std::uint8_t sign, std::uint64_t scale) {
+
+            out.insert(out.end(), { 'A', 'P', 'M', VERSION, static_cast<std::uint8_t>(kind), sign, 0, 0 });
+
+            put_word(out, scale);
+        }
+
+        Size Binary_Format::check_header(const std::uint8_t* data, Size size, KIND kind) {
+            /*
+                Return the header's length when it opens an encoding of the kind, in a
+                version this build reads, else 0.
+            */
+
+            if (size < HEADER || data[0] != 'A' || data[1] != 'P' || data[2] != 'M') {
+                return 0;
+            }
+
+            if (data[3] == 0 || data[3] > VERSION || data[4] != static_cast<std::uint8_t>(kind)) {
+                return 0;
+            }
+
+            return HEADER;
+        }
+
+        void Binary_Format::put_magnitude(Bytes& out, const Whole_Number& a) {
+            /*
+                The limbs are written as 64 bit words, pairing 32 bit limbs.
+            */
+
+            const Size limb_bits = Limb_Traits<Whole_Number::Word>::BITS;
+            const Size per_word  = 64 / limb_bits;
+
+            Size limbs = a.is() ? a.size_limbs() : 0;
+            Size words = (limbs + per_word - 1) / per_word;
+
+            put_word(out, words);
+
+            out.reserve(out.size() + 8 * words);
+
+            for (Size i = 0; i < words; ++i) {
+
+                std::uint64_t word = 0;
+
+                for (Size j = per_word; j-- > 0;) {
+
+                    Size limb = i * per_word + j;
+
+                    word = (limb_bits < 64 ? (word << (limb_bits % 64)) : 0) | (limb < limbs ? a._reg.at_reg(limb) : 0);
+                }
+
+                put_word(out, word);
+            }
+        }
+
+        Size Binary_Format::get_magnitude(const std::uint8_t* data, Size size, Whole_Number& a) {
+
+            const Size limb_bits = Limb_Traits<Whole_Number::Word>::BITS;
+            const Size per_word  = 64 / limb_bits;
+
+            if (size < 8) {
+                return 0;
+            }
+
+            std::uint64_t words = get_word(data);
+
+            if (words > (size - 8) / 8) {
+                return 0;
+            }
+
+            Whole_Number::Reg r(static_cast<Size>(words) * per_word, 0);
+
+            for (Size i = 0; i < words; ++i) {
+
+                std::uint64_t word = get_word(data + 8 + 8 * i);
+
+                for (Size j = 0; j < per_word; ++j) {
+
+                    r.at_reg(i * per_word + j) = static_cast<Whole_Number::Word>(word);
+
+                    word = (limb_bits < 64) ? (word >> (limb_bits % 64)) : 0;
+                }
+            }
+
+            r.trim();
+
+            a = Whole_Number(r);
+
+            return 8 + 8 * static_cast<Size>(words);
+        }
+
+        std::uint8_t Binary_Format::sign_of(const Integer& a) {
+            return static_cast<std::uint8_t>(a._sign);
+        }
+
+        Boolean Binary_Format::set_sign(Integer& a, std::uint8_t sign) {
+            /*
+                Give the decoded magnitude its category.  A finite category must agree
+                with whether the magnitude is zero.
+            */
+
+            if (sign > static_cast<std::uint8_t>(Integer::SIGN::pos_infinity)) {
+                return false;
+            }
+
+            Integer::SIGN category = static_cast<Integer::SIGN>(sign);
+
+            Boolean finite = category == Integer::SIGN::negative || category == Integer::SIGN::zero
+                          || category == Integer::SIGN::positive;
+
+            if (finite && (category == Integer::SIGN::zero) == a._number.is()) {
+                return false;
+            }
+
+            if (!finite) {
+                a._number = Whole_Number();
+            }
+
+            a._sign = category;
+
+            return true;
+        }
+
+        /********************************************************************************************/
+        //
+        //                              'Number_View' Class Definition
+        //
+        /********************************************************************************************/
+
+        Size Number_View::open(const std::uint8_t* data, Size size, Number_View& view) {
+
+            if (std::endian::native != std::endian::little || sizeof(Word) != 8) {
+                return 0;
+            }
+
+            if (reinterpret_cast<std::uintptr_t>(data) % alignof(std::uint64_t) != 0 || size < Binary_Format::HEADER) {
+                return 0;
+            }
+
+            KIND kind = static_cast<KIND>(data[4]);
+
+            if (data[4] > static_cast<std::uint8_t>(KIND::decimal) || !Binary_Format::check_header(data, size, kind)) {
+                return 0;
+            }
+
+            if (data[5] > static_cast<std::uint8_t>(Integer::SIGN::pos_infinity)) {
+                return 0;
+            }
+
+            Number_View v;
+
+            v._encoding = data;
+            v._kind     = kind;
+            v._sign     = data[5];
+            v._scale    = static_cast<Size>(Binary_Format::get_word(data + 8));
+
+            Size at = 16;
+
+            auto words = [&](const Word*& words, Size& count) -> Boolean {
+
+                if (size - at < 8) {
+                    return false;
+                }
+
+                std::uint64_t n = Binary_Format::get_word(data + at);
+
+                if (n > (size - at - 8) / 8) {
+                    return false;
+                }
+
+                count = static_cast<Size>(n);
+                words = reinterpret_cast<const Word*>(data + at + 8);
+
+                at += 8 + 8 * count;
+
+                return true;
+            };
+
+            if (!words(v._data, v._size) || (kind == KIND::rational && !words(v._den_data, v._den_size))) {
+                return 0;
+            }
+
+            while (v._size > 0 && v._data[v._size - 1] == 0) {
+                v._size -= 1;
+            }
+
+            while (v._den_size > 0 && v._den_data[v._den_size - 1] == 0) {
+                v._den_size -= 1;
+            }
+
+            view = v;
+
+            return at;
+        }
+
+        Number_View::Number_View()
+            : _encoding(nullptr), _kind(KIND::whole), _sign(static_cast<std::uint8_t>(Integer::SIGN::zero)), _scale(0), _data(nullptr), _size(0), _den_data(nullptr), _den_size(0) {
+        }
+
+        Number_View::KIND Number_View::kind() const {
+            return _kind;
+        }
+
+        Size Number_View::scale() const {
+            return _scale;
+        }
+
+        Boolean Number_View::is_negative() const {
+            return _sign == static_cast<std::uint8_t>(Integer::SIGN::negative)
+                || _sign == static_cast<std::uint8_t>(Integer::SIGN::neg_infinity);
+        }
+
+        Boolean Number_View::is_finite() const {
+            return _sign == static_cast<std::uint8_t>(Integer::SIGN::negative)
+                || _sign == static_cast<std::uint8_t>(Integer::SIGN::zero)
+                || _sign == static_cast<std::uint8_t>(Integer::SIGN::positive);
+        }
+
+        const Number_View::Word* Number_View::data() const {
+            return _data;
+        }
+
+        Size Number_View::size_limbs() const {
+            return _size;
+        }
+
+        const Number_View::Word* Number_View::denominator_data() const {
+            return _den_data;
+        }
+
+        Size Number_View::denominator_limbs() const {
+            return _den_size;
+        }
+
+        sys_float Number_View::compare(const Number_View& b) const {
+
+            if (!is_finite() || !b.is_finite()) {
+                return get_Integer().compare(b.get_Integer());
+            }
+
+            if (is_negative() != b.is_negative()) {
+                return is_negative() ? -1 : 1;
+            }
+
+            sys_float c = 0;
+
+            if (_size != b._size) {
+                c = (_size < b._size) ? -1 : 1;
+            }
+            else {
+                c = static_cast<sys_float>(cmp_n(_data, b._data, _size));
+            }
+
+            return is_negative() ? -c : c;
+        }
+
+        Integer Number_View::operator+(const Number_View& b) const {
+            return add(b, false);
+        }
+
+        Integer Number_View::operator-(const Number_View& b) const {
+            return add(b, true);
+        }
+
+        Integer Number_View::operator*(const Number_View& b) const {
+
+            if (!is_finite() || !b.is_finite()) {
+                return get_Integer() * b.get_Integer();
+            }
+
+            if (_size == 0 || b._size == 0) {
+                return Integer();
+            }
+
+            Whole_Number::Reg r(_size + b._size, 0);
+
+            if (_size >= b._size) {
+                mul(r.data(), _data, _size, b._data, b._size);
+            }
+            else {
+                mul(r.data(), b._data, b._size, _data, _size);
+            }
+
+            r.trim();
+
+            Integer a{ Whole_Number(r) };
+
+            return (is_negative() != b.is_negative()) ? -a : a;
+        }
+
+        Integer Number_View::get_Integer() const {
+
+            Integer a;
+
+            Whole_Number::Reg r(_size, 0);
+
+            for (Size i = 0; i < _size; ++i) {
+                r.at_reg(i) = _data[i];
+            }
+
+            a._number = Whole_Number(r);
+
+            Binary_Format::set_sign(a, _sign);
+
+            return a;
+        }
+
+        Integer Number_View::add(const Number_View& b, Boolean negate_b) const {
+            /*
+                Add the magnitudes when the signs agree, else take the smaller from
+                the larger, and the sign of the larger.
+            */
+
+            if (!is_finite() || !b.is_finite()) {
+                return negate_b ? get_Integer() - b.get_Integer() : get_Integer() + b.get_Integer();
+            }
+
+            Boolean negative   = is_negative();
+            Boolean negative_b = b.is_negative() != negate_b;
+
+            const Number_View* x = this;
+            const Number_View* y = &b;
+
+            if (_size < b._size || (_size == b._size && cmp_n(_data, b._data, _size) < 0)) {
+                std::swap(x, y);
+                std::swap(negative, negative_b);
+            }
+
+            Whole_Number::Reg r(x->_size + 1, 0);
+
+            if (negative == negative_b) {
+                Word carry = add_n(r.data(), x->_data, y->_data, y->_size);
+                carry      = add_1(r.data() + y->_size, x->_data + y->_size, x->_size - y->_size, carry);
+
+                r.at_reg(x->_size) = carry;
+            }
+            else {
+                Word borrow = sub_n(r.data(), x->_data, y->_data, y->_size);
+                sub_1(r.data() + y->_size, x->_data + y->_size, x->_size - y->_size, borrow);
+            }
+
+            r.trim();
+
+            Integer a{ Whole_Number(r) };
+
+            return negative ? -a : a;
+        }
+    }
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include <cstdint>
+#include <vector>
+#include "Whole_Number.h"
+#include "Integer.h"
+#include "Rational.h"
+#include "Decimal.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                              'Binary_Format' Class Declaration
+        //
+        //        A versioned encoding of the numerical types, the same on every platform.  All
+        //        fields are little endian and 8 byte aligned from the start of an encoding:
+        //
+        //            0   'A' 'P' 'M', then the format version
+        //            4   the kind of number, then its sign category, then 2 bytes of zero
+        //            8   the scale of a Decimal, else zero
+        //            16  the count of 64 bit words of the magnitude, then the words
+        //                A Rational follows with the count and words of its denominator.
+        //
+        //        The magnitude is the number of an Integer, the numerator of a Rational, and
+        //        the scaled number of a Decimal.  A decode reports the bytes it read, or zero
+        //        when the bytes are not an encoding of the type.
+        //
+        /********************************************************************************************/
+
+        class Binary_Format {
+
+        public:
+
+            typedef std::vector<std::uint8_t> Bytes;
+
+            enum class KIND : std::uint8_t {
+                whole = 0, integer, rational, decimal
+            };
+
+            static const std::uint8_t VERSION = 1;
+            static const Size         HEADER  = 24;     // The bytes before the words of the magnitude.
+
+            static void encode(const Whole_Number& a, Bytes& out);     // Append the encoding to 'out'.
+            static void encode(const Integer&      a, Bytes& out);
+            static void encode(const Rational&     a, Bytes& out);
+            static void encode(const Decimal&      a, Bytes& out);
+
+            static Size decode(const std::uint8_t* data, Size size, Whole_Number& a);
+            static Size decode(const std::uint8_t* data, Size size, Integer&      a);
+            static Size decode(const std::uint8_t* data, Size size, Rational&     a);
+            static Size decode(const std::uint8_t* data, Size size, Decimal&      a);
+
+        private:
+
+            friend class Number_View;
+
+            static void          put_word(Bytes& out, std::uint64_t word);
+            static std::uint64_t get_word(const std::uint8_t* data);
+
+            static void put_header   (Bytes& out, KIND kind, std::uint8_t sign, std::uint64_t scale);
+            static Size check_header (const std::uint8_t* data, Size size, KIND kind);
+            static void put_magnitude(Bytes& out, const Whole_Number& a);
+            static Size get_magnitude(const std::uint8_t* data, Size size, Whole_Number& a);   // The bytes read, or 0.
+
+            static std::uint8_t sign_of(const Integer& a);
+            static Boolean      set_sign(Integer& a, std::uint8_t sign);
+        };
+
+        /********************************************************************************************/
+        //
+        //                              'Number_View' Class Declaration
+        //
+        //        A read only view of an encoding held in memory, such as a mapped file.  The
+        //        words of the magnitude are used in place, so a view is only opened where the
+        //        platform's limbs are 64 bit little endian words, and the encoding is 8 byte
+        //        aligned.  Elsewhere 'open' fails, and the encoding must be decoded.
+        //
+        //        The arithmetic is on the signed magnitudes, without copying either operand.
+        //        A non finite operand is copied, and follows the rules of an Integer.
+        //
+        /********************************************************************************************/
+
+        class Number_View {
+
+        public:
+
+            typedef Binary_Format::KIND KIND;
+            typedef Whole_Number::Word  Word;
+
+            static Size open(const std::uint8_t* data, Size size, Number_View& view);  // The bytes viewed, or 0.
+
+            Number_View();
+
+            KIND    kind()        const;
+            Size    scale()       const;
+            Boolean is_negative() const;
+            Boolean is_finite()   const;
+
+            const Word* data()       const;                     // The words of the magnitude.
+            Size        size_limbs() const;
+
+            const Word* denominator_data()  const;              // The words of a Rational's denominator.
+            Size        denominator_limbs() const;
+
+            sys_float compare(const Number_View& b) const;
+
+            Integer operator+(const Number_View& b) const;
+            Integer operator-(const Number_View& b) const;
+            Integer operator*(const Number_View& b) const;
+
+            Integer get_Integer() const;                         // A copy of the signed magnitude.
+
+        private:
+
+            const std::uint8_t* _encoding;
+            KIND                _kind;
+            std::uint8_t        _sign;
+            Size                _scale;
+            const Word*         _data;
+            Size                _size;
+            const Word*         _den_data;
+            Size                _den_size;
+
+            Integer add(const Number_View& b, Boolean negate_b) const;
+        };
+    }
+}
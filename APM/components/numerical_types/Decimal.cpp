@@ -1,1054 +1,2163 @@
-
-/*********************************************************************/
-//
-//			Copyright 2022 Max J. Martin
-//
-//			This file is part of APM.
-// 
-//			APM is free software : you can redistribute it
-//			and /or modify it under the terms of the GNU General
-//			Public License as published by the Free Software
-//			Foundation, either version 3 of the License, or
-//			(at your option) any later version.
-//			
-//			APM is distributed in the hope that it will be
-//			useful, but WITHOUT ANY WARRANTY; without even the
-//			implied warranty of MERCHANTABILITY or FITNESS FOR
-//			A PARTICULAR PURPOSE.See the GNU General Public
-//			
-//			You should have received a copy of the GNU General
-//			Public License along with APM.If not, see
-//			< https://www.gnu.org/licenses/>.
-//			
-/*********************************************************************/
-
-#include "Decimal.h"
-
-namespace Olly {
-    namespace APM {
-
-        Decimal::Decimal() : _number() {
-        }
-
-        Decimal::Decimal(sys_int value) : _number(value) {
-            _number *= denominator();
-        }
-
-        Decimal::Decimal(const Integer& value) : _number(value) {
-            _number *= denominator();
-        }
-
-        Decimal::Decimal(const Whole_Number& value) : _number(value) {
-            _number *= denominator();
-        }
-
-        Decimal::Decimal(Text value) : _number() {
-            if (scale_not_configured()) {
-                scale(Decimal::DEF_SCALE);
-            }
-
-            value = to_lower(value);
-
-            if (value.size() > 1) {
-
-                if (value.find('.') != Text::npos) {
-                    set_decimal(value);
-                }
-
-                else if (value.find('/') != Text::npos) {
-                    set_rational(value);
-                }
-
-                else if (value[0] == '0' && std::isalpha(value[1])) {
-
-                    if (value[0] == '0' && value[1] == 'u') {
-                        value[0] = ' ';
-                        value[1] = ' ';
-                        set_whole(value);
-                    }
-
-                    else if (value[0] == '0' && value[1] == 'b') {
-                        value[0] = ' ';
-                        value[1] = ' ';
-                        set_binary(value);
-                    }
-
-                    else if (value[0] == '0' && value[1] == 'x') {
-                        value[0] = ' ';
-                        value[1] = ' ';
-                        set_heximal(value);
-                    }
-
-                    else if (value[0] == '0' && value[1] == 'o') {
-                        value[0] = ' ';
-                        value[1] = ' ';
-                        set_octal(value);
-                    }
-
-                    else {
-                        set_integer(value);
-                    }
-                }
-
-                else {
-                    set_integer(value);
-                }
-            }
-
-            else {
-                set_integer(value);
-            }
-        }
-
-        Decimal::~Decimal() {
-        }
-
-        Boolean Decimal::is() const {
-            return _number.is();
-        }
-
-        Boolean Decimal::is_odd() const {
-            return _number.is_odd();
-        }
-
-        Boolean Decimal::is_even() const {
-            return _number.is_even();
-        }
-
-        Boolean Decimal::is_positive() const {
-            return _number.is_positive();
-        }
-
-        Boolean Decimal::is_negative() const {
-            return _number.is_negative();
-        }
-
-        Boolean Decimal::is_zero() const {
-            return _number.is_zero();
-        }
-
-        Boolean Decimal::is_undefined() const {
-            return _number.is_undefined();
-        }
-
-        Boolean Decimal::is_defined() const {
-            return _number.is_defined();
-        }
-
-        Boolean Decimal::is_nan() const {
-            return _number.is_nan();
-        }
-
-        Boolean Decimal::is_finite() const {
-            return _number.is_finite();
-        }
-
-        Boolean Decimal::is_infinite() const {
-            return _number.is_infinite();
-        }
-
-        Boolean Decimal::operator==(const Decimal& b) const {
-            return compare(b) == 0;
-        }
-
-        Boolean Decimal::operator!=(const Decimal& b) const {
-            return compare(b) != 0;
-        }
-
-        Boolean Decimal::operator>=(const Decimal& b) const {
-            return compare(b) >= 0;
-        }
-
-        Boolean Decimal::operator<=(const Decimal& b) const {
-            return compare(b) <= 0;
-        }
-
-        Boolean Decimal::operator>(const Decimal& b) const {
-            return compare(b) > 0;
-        }
-
-        Boolean Decimal::operator<(const Decimal& b) const {
-            return compare(b) < 0;
-        }
-
-        sys_float Decimal::compare(const Decimal& b) const {
-
-            return _number.compare(b._number);
-        }
-
-        Decimal& Decimal::operator+=(const Decimal& b) {
-
-            _number += b._number;
-
-            return *this;
-        }
-
-        Decimal& Decimal::operator-=(const Decimal& b) {
-            return operator+=(-b);
-        }
-
-        Decimal& Decimal::operator*=(const Decimal& b) {
-
-            _number *= b._number;
-
-            _number /= denominator();
-
-            return *this;
-        }
-
-        Decimal& Decimal::operator/=(const Decimal& b) {
-
-            _number *= denominator();
-
-            _number /= b._number;
-
-            return *this;
-        }
-
-        Decimal& Decimal::operator%=(const Decimal& b) {
-
-            operator/=(b);
-
-            _number %= denominator();
-
-            return *this;
-        }
-
-        Decimal Decimal::operator+(const Decimal& b) const {
-
-            Decimal a(*this);
-
-            a += b;
-
-            return a;
-        }
-
-        Decimal Decimal::operator-(const Decimal& b) const {
-
-            Decimal a(*this);
-
-            a -= b;
-
-            return a;
-        }
-
-        Decimal Decimal::operator*(const Decimal& b) const {
-
-            Decimal a(*this);
-
-            a *= b;
-
-            return a;
-        }
-
-        Decimal Decimal::operator/(const Decimal& b) const {
-
-            Decimal a(*this);
-
-            a /= b;
-
-            return a;
-        }
-
-        Decimal Decimal::operator%(const Decimal& b) const {
-
-            Decimal a(*this);
-
-            a %= b;
-
-            return a;
-        }
-
-        Decimal Decimal::operator+() const {
-
-            Decimal a(*this);
-
-            return a;
-        }
-
-        Decimal Decimal::operator-() const {
-
-            Decimal a(*this);
-
-            a._number = -a._number;
-
-            return a;
-        }
-
-        void Decimal::div_rem(const Decimal& b, Decimal& qot, Decimal& rem) const {
-            (_number * denominator()).div_rem(b._number, qot._number, rem._number);
-        }
-
-        Decimal Decimal::abs() const {
-
-            Decimal a;
-
-            a._number = _number.abs();
-
-            return a;
-        }
-
-        Decimal Decimal::inverse() const {
-
-            Decimal a(denominator());
-
-            a._number /= _number;
-
-            return a;
-        }
-
-        Decimal Decimal::ceil() const {
-
-            if (decimal_scale() == 0) {
-                return *this;
-            }
-
-            Decimal a(*this);
-
-            Integer q, r;
-            a._number.div_rem(denominator(), q, r);
-
-            a._number = q * denominator();
-
-            if (r.is()) {
-
-                if (a.is_positive()) {
-                    a._number += denominator();
-                }
-                else {
-                    a._number -= denominator();
-                }
-            }
-
-            return a;
-        }
-
-        Decimal Decimal::floor() const {
-
-            if (decimal_scale() == 0) {
-                return *this;
-            }
-
-            Decimal a(*this);
-
-            Integer q, r;
-            a._number.div_rem(denominator(), q, r);
-
-            a._number = q * denominator();
-
-            if (r.is()) {
-
-                if (a.is_positive()) {
-                    a._number -= denominator();
-                }
-                else {
-                    a._number += denominator();
-                }
-            }
-
-            return a;
-        }
-
-        Decimal Decimal::gcd(const Decimal& b) const {
-            
-            if (is_defined() && b.is_defined()) {
-
-                Decimal a(*this);
-
-                a._number = a._number.gcd(b._number);
-
-                return a;
-            }
-
-            return Integer::UNDEF;
-        }
-
-        Decimal Decimal::pow(const Decimal& b) const {
-
-            if (is_defined() && b.is_defined()) {
-
-                Size n = b.to_integral<Size>();
-
-                if (n == 2) {
-                    Decimal a = *this;
-                    return a * a;
-                }
-
-                if (n == 1) {
-                    return *this;
-                }
-
-                if (b == 0) {
-                    return 1;
-                }
-
-                Decimal a = *this;
-                Decimal res = 1;
-
-                while (n) {
-
-                    if (n & 1) {
-
-                        res *= a;
-                    }
-
-                    n >>= 1;
-
-                    if (n) {
-                        a *= a;
-                    }
-                }
-
-                return res;
-            }
-
-            return Integer::UNDEF;
-        }
-
-        Decimal Decimal::root(const Decimal& b) const {
-
-            // e^(ln(*this)/b) - Will need to see if this is faster, in the future.
-
-            if (is_defined() && b.is_defined()) {
-
-                Size n = b.to_integral<Size>();
-
-                if (n > MAX_SCALE || is_negative()) {
-                    return Integer::UNDEF;
-                }
-
-                Decimal a = *this * denominator().pow(n - 1);
-
-                a._number = a._number.root(n);
-
-                return a;
-            }
-
-            return Integer::UNDEF;
-        }
-
-        Decimal Decimal::hypot(const Decimal& b) const {
-
-            return (operator*(*this) + (b * b)).root(2);
-        }
-
-        Decimal Decimal::hypot(const Decimal& b, const Decimal& c) const {
-
-            return (operator*(*this) + (b * b) + (c * c)).root(2);
-        }
-
-        Decimal Decimal::ln() const {
-
-            if ((_number == denominator())) {
-                return Decimal();
-            }
-            else if ((_number == integer_e())) {
-                return Decimal(1);
-            }
-
-            if ((_number > denominator())) {
-                /*
-                    Factor out the power of 2.  Then get ln().
-                    This greatly improves speed of convergance.
-                */
-
-                Size  exp = (_number / denominator()).get_Whole_Number().get_Binary_Register().lead_bit() - 1;
-                Integer x = _number.get_Whole_Number() >> exp;
-
-                Decimal r;
-                r._number = x;
-
-                // return ln(x) + ln(2) * exp
-                return (r.get_ln() + decimal_ln2() * Decimal(exp));
-            }
-
-            return -get_ln();
-        }
-
-        Decimal Decimal::log2() const {
-            return log(Decimal(2));
-        }
-
-        Decimal Decimal::log10() const {
-            return log(Decimal(10));
-        }
-
-        Decimal Decimal::log(const Decimal& b) const {
-            
-            if (is_defined() && is_positive()) {
-
-                Decimal a = ln() / b.ln();
-
-                Decimal c(a);
-
-                if (b.pow(c) == *this) {
-                    return c;
-                }
-
-                return a;
-            }
-
-            return Integer::UNDEF;
-        }
-
-        Decimal Decimal::sin() const {
-            
-            Decimal sin_x = abs();
-
-            Boolean neg = is_negative() ? true : false;
-
-            /*
-                First reduce value closure to 0.5
-                to improve speed of convergance.  
-            */
-
-            if (sin_x > decimal_360()) {
-                sin_x %= decimal_360();
-            }
-
-            if (sin_x > decimal_180()) {
-                sin_x %= decimal_180();
-                neg = !neg;
-            }
-
-            sin_x *= (decimal_pi() / decimal_180());  // Convert to radians.  
-
-            sin_x = sin_x.get_sin();
-
-            return neg ? -sin_x : sin_x;
-        }
-
-        Decimal Decimal::cos() const {
-
-            Decimal sin_x = sin();
-            Decimal one(1);
-
-            return (one - (sin_x * sin_x)).root(2); 
-        }
-
-        Decimal Decimal::tan() const {
-
-            Decimal one(1);
-            Decimal sin_x = sin();
-            Decimal cos_x = (one - (sin_x * sin_x)).root(2);
-
-            return sin_x / cos_x;
-        }
-
-
-        Decimal Decimal::asin() const {
-
-            Decimal asin_x = abs();
-
-            Boolean neg = is_negative() ? true : false;
-
-            /*
-                First reduce value closure to 0.5
-                to improve speed of convergance.
-            */
-
-            sys_int power_of_2 = 0;
-
-            Decimal limit("0.5");
-            Decimal one(ONE);
-            Decimal two(TWO);
-
-            while (asin_x > limit) {
-
-                asin_x = asin_x / (one + (one + asin_x * asin_x).root(two));
-
-                power_of_2 += 1;
-            }
-
-            asin_x = asin_x.get_asin() * two.pow(power_of_2);
-
-            return neg ? -asin_x : asin_x;
-        }
-
-        Decimal Decimal::acos() const {
-            
-            return (decimal_pi() / 2) - asin();
-        }
-
-        Decimal Decimal::atan() const {
-
-            Decimal sinh_x = abs();
-
-            Boolean neg = is_negative() ? true : false;
-
-            /*
-                First reduce value closure to 0.5
-                to improve speed of convergance.
-            */
-
-            sys_int power_of_2 = 0;
-
-            Decimal limit("0.1");
-            Decimal one(ONE);
-            Decimal two(TWO);
-
-            while (sinh_x > limit) {
-
-                sinh_x = sinh_x / (one + (one + sinh_x * sinh_x).root(two));
-
-                power_of_2 += 1;
-            }
-
-            sinh_x = sinh_x.get_atan() * two.pow(power_of_2);
-
-            return neg ? -sinh_x : sinh_x;
-        }
-
-        Decimal Decimal::sinh() const {
-            
-            Decimal sinh_x = abs();
-
-            Boolean neg = is_negative() ? true : false;
-
-            sinh_x = sinh_x.get_sinh();
-
-            return neg ? -sinh_x : sinh_x;
-        }
-
-        Decimal Decimal::cosh() const {
-
-            Decimal cosh_x = abs();
-
-            Boolean neg = is_negative() ? true : false;
-
-            cosh_x = cosh_x.get_cosh();
-
-            return neg ? -cosh_x : cosh_x;
-        }
-
-        Decimal Decimal::tanh() const {
-            return sinh() / cosh();
-        }
-
-        Decimal Decimal::asinh() const {
-            return (*this + ( *this * *this + 1).root(2)).ln();
-        }
-
-        Decimal Decimal::acosh() const {
-            return (*this + (*this * *this - 1).root(2)).ln();
-        }
-
-        Decimal Decimal::atanh() const {
-            return Decimal("0.5") * ((Decimal(1) + *this) / (Decimal(1) - *this)).ln();
-        }
-
-        Text Decimal::sign() const {
-            return _number.sign();
-        }
-
-        Text Decimal::to_string() const {
-            return to_string(10, -1);
-        }
-
-        Text Decimal::to_string(Size base, sys_int sign) const {
-
-            Integer qot, rem;
-            _number.div_rem(denominator(), qot, rem);
-
-            Text result = qot.to_string(0, -1);
-
-            Text decimal_string = rem.to_string(0, -1);
-
-            if (decimal_string.size() || decimal_string.size() < decimal_scale()) {
-
-                decimal_string.insert(0, decimal_scale() - decimal_string.size(), '0');
-            }
-
-            if (rem.is()) {
-                result += "." + decimal_string;
-            }
-            else {
-                result += ".0";
-            }
-
-            return result;
-        }
-
-        const Integer& Decimal::get_Integer() const {
-            return _number;
-        }
-
-        Decimal Decimal::get_ln() const {
-            /*
-                Perform a Taylor Series estimation of
-                the natural logorithm of this number.
-            */
-
-            Decimal one(ONE);
-            Decimal two(TWO);
-
-            Decimal x = (*this - one) / (*this + one); 
-
-            Decimal ln_x_iter = x;
-            Decimal ln_x      = x;
-
-            Decimal denominator(3);
-
-            Decimal last_iter;
-
-            // Perform the calculation until the last 'last_iter' Decimal
-            // is the same as the current calculation 'ln_x'.  
-
-            while (last_iter != ln_x) {
-                last_iter = ln_x;
-
-                ln_x_iter *= x;
-                ln_x_iter *= x;
-
-                ln_x += (one / denominator) * ln_x_iter;
-
-                denominator += two;
-            }
-
-            return ln_x * two;
-        }
-
-        Decimal Decimal::get_sin() const {
-
-            Decimal one   = 1;
-            Decimal x     = *this;
-            Decimal sin_x = x;
-
-            Decimal sin_x_iter = x;
-
-            Decimal sin_power(3);
-            Decimal sin_factorial(6);
-
-            Decimal last;
-
-            // Perform the calculation until the last 'last_iter' Decimal
-            // is the same as the current calculation 'term'.  
-
-            while (last.get_Integer().get_Whole_Number() != sin_x.get_Integer().get_Whole_Number()) {
-
-                last = sin_x;
-
-                sin_x = -sin_x;
-
-                sin_x_iter *= x;
-                sin_x_iter *= x;
-
-                sin_x += (one / sin_factorial) * sin_x_iter;
-
-                sin_power     += one;
-                sin_factorial *= sin_power;
-
-                sin_power     += one;
-                sin_factorial *= sin_power;
-            }
-
-            return sin_x;
-        }
-
-        Decimal Decimal::get_asin() const {
-            
-            /*
-                Perform a Taylor Series estimation of
-                the natural logorithm of this number.
-            */
-
-            Decimal one(ONE);
-            Decimal two(TWO);
-
-            Decimal x = *this;
-            Decimal asin_x = x;
-
-            Decimal asin_x_iter = x;
-
-            Decimal asin_power(3);
-
-            Decimal num_coef(1);
-            Decimal den_coef(2);
-
-            Decimal last;
-
-            // Perform the calculation until the last 'last_iter' Decimal
-            // is the same as the current calculation 'term'.  
-
-            while (last.get_Integer().get_Whole_Number() != asin_x.get_Integer().get_Whole_Number()) {
-
-                last = asin_x;
-
-                // asin_x = -asin_x;
-
-                asin_x_iter *= x;
-                asin_x_iter *= x;
-
-                asin_x += (one / (den_coef * asin_power)) * (num_coef * asin_x_iter);
-
-                num_coef   *= asin_power;
-                asin_power += one;
-                den_coef   *= asin_power;
-                asin_power += one;
-            }
-
-            return asin_x;
-        }
-
-        Decimal Decimal::get_atan() const {
-
-            /*
-                Perform a Taylor Series estimation of
-                the natural logorithm of this number.
-            */
-
-            Decimal one(ONE);
-            Decimal two(TWO);
-
-            Decimal x = *this;
-            Decimal sinh_x = x;
-
-            Decimal sinh_x_iter = x;
-
-            Decimal atan_power(3);
-
-            Decimal last;
-
-            // Perform the calculation until the last 'last_iter' Decimal
-            // is the same as the current calculation 'term'.  
-
-            while (last.get_Integer().get_Whole_Number() != sinh_x.get_Integer().get_Whole_Number()) {
-
-                last = sinh_x;
-
-                sinh_x = -sinh_x;
-
-                sinh_x_iter *= x;
-                sinh_x_iter *= x;
-
-                sinh_x += (one / atan_power) * sinh_x_iter;
-
-                atan_power += two;
-            }
-
-            return sinh_x;
-        }
-
-        Decimal Decimal::get_sinh() const {
-
-            Decimal one = 1;
-            Decimal x = *this;
-            Decimal sinh_x = x;
-
-            Decimal sinh_x_iter = x;
-
-            Decimal sin_power(3);
-            Decimal sin_factorial(6);
-
-            Decimal last;
-
-            // Perform the calculation until the last 'last_iter' Decimal
-            // is the same as the current calculation 'term'.  
-
-            while (last.get_Integer().get_Whole_Number() != sinh_x.get_Integer().get_Whole_Number()) {
-
-                last = sinh_x;
-
-                sinh_x_iter *= x;
-                sinh_x_iter *= x;
-
-                sinh_x += (one / sin_factorial) * sinh_x_iter;
-
-                sin_power += one;
-                sin_factorial *= sin_power;
-
-                sin_power += one;
-                sin_factorial *= sin_power;
-            }
-
-            return sinh_x;
-        }
-
-        Decimal Decimal::get_cosh() const {
-
-            Decimal one = 1;
-            Decimal x = *this;
-            Decimal cosh_x = one;
-
-            Decimal cosh_x_iter = one;
-
-            Decimal cos_power(2);
-            Decimal cos_factorial(2);
-
-            Decimal last;
-
-            // Perform the calculation until the last 'last_iter' Decimal
-            // is the same as the current calculation 'term'.  
-
-            while (last.get_Integer().get_Whole_Number() != cosh_x.get_Integer().get_Whole_Number()) {
-
-                last = cosh_x;
-
-                cosh_x_iter *= x;
-                cosh_x_iter *= x;
-
-                cosh_x += (one / cos_factorial) * cosh_x_iter;
-
-                cos_power += one;
-                cos_factorial *= cos_power;
-
-                cos_power += one;
-                cos_factorial *= cos_power;
-            }
-
-            return cosh_x;
-        }
-
-        void Decimal::set_integer(Text& value) {
-            _number = Integer(value) * denominator();
-        }
-
-        void Decimal::set_decimal(Text& value) {
-
-            lrtrim(value);
-
-            if (!value.empty()) {
-
-                Integer exponent = get_sub_text_value(value, "e");
-
-                Size scale = find_and_set_scale(value);
-
-                _number = Integer(value);
-
-                if (scale < decimal_scale()) {
-                    _number = _number * (denominator() / TEN.pow(scale));
-                }
-
-                set_decimal_exponent(exponent);
-            }
-        }
-
-        void Decimal::set_rational(Text& value) {
-
-            // Locate and set the denominator.
-            Integer den(get_sub_text_value(value, "/"));
-
-            if (!den.is()) {
-                _number = Integer::UNDEF;
-                return;
-            }
-
-            lrtrim(value);
-
-            // Look if a leading integer is present and get it.
-            Text lead_val_str = "";
-
-            auto found = value.find_last_of(' ');
-
-            if (found != std::string::npos) {
-
-                lead_val_str = value.substr(0, found);
-
-                value.erase(0, found);
-            }
-
-            // Define the leading integer.
-            Integer lead_value(lead_val_str);
-
-            _number = Integer(value);
-
-            // Add any leading value to the number.
-            if (lead_value.is()) {
-
-                _number = _number + (lead_value * den);
-            }
-
-            _number *= denominator();
-            _number /= den;
-        }
-
-        void Decimal::set_whole(Text& value) {
-            _number = Integer(value, 10);
-        }
-
-        void Decimal::set_binary(Text& value) {
-            _number = Integer(value, 2);
-        }
-
-        void Decimal::set_octal(Text& value) {
-            _number = Integer(value, 8);
-        }
-
-        void Decimal::set_heximal(Text& value) {
-            _number = Integer(value, 16);
-        }
-
-        void Decimal::set_decimal_exponent(Integer& exponent) {
-            /*
-                Test if an exponent was defined then apply the exponent.
-                Then reset the _scale of the decimal number.
-            */
-            if (exponent.is()) {
-
-                Size n = (exponent / denominator()).to_integral<Size>();
-
-                Integer exp = TEN.pow(n);
-
-                if (exponent.is_negative()) {
-
-                    _number = _number / exp;
-                }
-                else if (exponent.is_positive()) {
-
-                    _number = _number * exp;
-                }
-            }
-        }
-
-        Integer Decimal::get_sub_text_value(Text& value, Text del) const {
-            /*
-                See if a value is defined for a specific deliminator.  If found get and
-                return the Ineger after the delimeter, preserving the remaingin text.
-            */
-            auto found = value.find(del);
-
-            Text sub_string_value = "";
-
-            Integer derived_value;
-
-            if (found != std::string::npos) {
-
-                if (value.begin() + found < value.end()) {
-                    sub_string_value = value.substr(found + 1);
-                }
-                value.erase(found);
-
-                derived_value = Integer(sub_string_value);
-            }
-
-            return derived_value;
-        }
-
-        Size Decimal::find_and_set_scale(Text& value) const {
-            /*
-                Find the decimal point which is required to for all
-                Decimal number text input.
-            */
-
-            sys_int scale = 0;
-
-            auto found = value.find(".");
-
-            if (found != std::string::npos) {
-                value.at(found) = ' ';
-
-                scale = static_cast<sys_int>(value.size() - found) - 1;
-                if (scale < 1) {
-                    scale = 0;
-                }
-            }
-
-            if (scale > decimal_scale()) {
-
-                value.resize(value.size() - (scale - decimal_scale()));
-            }
-
-            return scale;
-        }
-    }
-}  // end Olly
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+// 
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//			
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//			
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//			
+/*********************************************************************/
+
+#include <cmath>
+#include "Decimal.h"
+#include "Literals.h"
+#include "Power_Cache.h"
+
+namespace Olly {
+    namespace APM {
+
+        using namespace literals;
+
+        Decimal::Decimal() : _number(), _scale(decimal_scale()) {
+        }
+
+        Decimal::Decimal(sys_int value) : _number(value), _scale(decimal_scale()) {
+            _number *= denominator();
+        }
+
+        Decimal::Decimal(const Integer& value) : _number(value), _scale(decimal_scale()) {
+            _number *= denominator();
+        }
+
+        Decimal::Decimal(const Whole_Number& value) : _number(value), _scale(decimal_scale()) {
+            _number *= denominator();
+        }
+
+        Decimal::Decimal(Text value) : _number(), _scale(decimal_scale()) {
+
+            value = to_lower(value);
+
+            if (value.size() > 1) {
+
+                if (value.find('.') != Text::npos) {
+                    set_decimal(value);
+                }
+
+                else if (value.find('/') != Text::npos) {
+                    set_rational(value);
+                }
+
+                else if (value[0] == '0' && std::isalpha(value[1])) {
+
+                    if (value[0] == '0' && value[1] == 'u') {
+                        value[0] = ' ';
+                        value[1] = ' ';
+                        set_whole(value);
+                    }
+
+                    else if (value[0] == '0' && value[1] == 'b') {
+                        value[0] = ' ';
+                        value[1] = ' ';
+                        set_binary(value);
+                    }
+
+                    else if (value[0] == '0' && value[1] == 'x') {
+                        value[0] = ' ';
+                        value[1] = ' ';
+                        set_heximal(value);
+                    }
+
+                    else if (value[0] == '0' && value[1] == 'o') {
+                        value[0] = ' ';
+                        value[1] = ' ';
+                        set_octal(value);
+                    }
+
+                    else {
+                        set_integer(value);
+                    }
+                }
+
+                else {
+                    set_integer(value);
+                }
+            }
+
+            else {
+                set_integer(value);
+            }
+        }
+
+        Decimal::~Decimal() {
+        }
+
+        Boolean Decimal::is() const {
+            return _number.is();
+        }
+
+        Boolean Decimal::is_odd() const {
+            return _number.is_odd();
+        }
+
+        Boolean Decimal::is_even() const {
+            return _number.is_even();
+        }
+
+        Boolean Decimal::is_positive() const {
+            return _number.is_positive();
+        }
+
+        Boolean Decimal::is_negative() const {
+            return _number.is_negative();
+        }
+
+        Boolean Decimal::is_zero() const {
+            return _number.is_zero();
+        }
+
+        Boolean Decimal::is_undefined() const {
+            return _number.is_undefined();
+        }
+
+        Boolean Decimal::is_defined() const {
+            return _number.is_defined();
+        }
+
+        Boolean Decimal::is_nan() const {
+            return _number.is_nan();
+        }
+
+        Boolean Decimal::is_finite() const {
+            return _number.is_finite();
+        }
+
+        Boolean Decimal::is_infinite() const {
+            return _number.is_infinite();
+        }
+
+        Boolean Decimal::operator==(const Decimal& b) const {
+            return compare(b) == 0;
+        }
+
+        Boolean Decimal::operator!=(const Decimal& b) const {
+            return compare(b) != 0;
+        }
+
+        Boolean Decimal::operator>=(const Decimal& b) const {
+            return compare(b) >= 0;
+        }
+
+        Boolean Decimal::operator<=(const Decimal& b) const {
+            return compare(b) <= 0;
+        }
+
+        Boolean Decimal::operator>(const Decimal& b) const {
+            return compare(b) > 0;
+        }
+
+        Boolean Decimal::operator<(const Decimal& b) const {
+            return compare(b) < 0;
+        }
+
+        sys_float Decimal::compare(const Decimal& b) const {
+
+            if (_scale != b._scale) {
+                // Compare exactly at the finer of the two scales.
+                if (_scale < b._scale) {
+                    return (_number * denominator(b._scale - _scale)).compare(b._number);
+                }
+
+                return _number.compare(b._number * denominator(_scale - b._scale));
+            }
+
+            return _number.compare(b._number);
+        }
+
+        Decimal& Decimal::operator+=(const Decimal& b) {
+
+            if (!align(b)) {
+                return operator+=(b.rescaled());
+            }
+
+            _number += b._number;
+
+            return *this;
+        }
+
+        Decimal& Decimal::operator-=(const Decimal& b) {
+            return operator+=(-b);
+        }
+
+        Decimal& Decimal::operator*=(const Decimal& b) {
+
+            if (!align(b)) {
+                return operator*=(b.rescaled());
+            }
+
+            _number = divide(_number * b._number, divisor(), round_mode());
+
+            return *this;
+        }
+
+        Decimal& Decimal::operator/=(const Decimal& b) {
+
+            if (!align(b)) {
+                return operator/=(b.rescaled());
+            }
+
+            _number = divide(_number * denominator(), b._number, round_mode());
+
+            return *this;
+        }
+
+        Decimal& Decimal::operator%=(const Decimal& b) {
+
+            operator/=(b);
+
+            _number %= denominator();
+
+            return *this;
+        }
+
+        Decimal Decimal::operator+(const Decimal& b) const {
+
+            Decimal a(*this);
+
+            a += b;
+
+            return a;
+        }
+
+        Decimal Decimal::operator-(const Decimal& b) const {
+
+            Decimal a(*this);
+
+            a -= b;
+
+            return a;
+        }
+
+        Decimal Decimal::operator*(const Decimal& b) const {
+
+            Decimal a(*this);
+
+            a *= b;
+
+            return a;
+        }
+
+        Decimal Decimal::operator/(const Decimal& b) const {
+
+            Decimal a(*this);
+
+            a /= b;
+
+            return a;
+        }
+
+        Decimal Decimal::operator%(const Decimal& b) const {
+
+            Decimal a(*this);
+
+            a %= b;
+
+            return a;
+        }
+
+        Decimal Decimal::operator+() const {
+
+            Decimal a(*this);
+
+            return a;
+        }
+
+        Decimal Decimal::operator-() const {
+
+            Decimal a(*this);
+
+            a._number = -a._number;
+
+            return a;
+        }
+
+        void Decimal::div_rem(const Decimal& b, Decimal& qot, Decimal& rem) const {
+
+            if (_scale != decimal_scale() || b._scale != decimal_scale()) {
+                return rescaled().div_rem(b.rescaled(), qot, rem);
+            }
+
+            (_number * denominator()).div_rem(b._number, qot._number, rem._number);
+
+            qot._scale = _scale;
+            rem._scale = _scale;
+        }
+
+        Decimal Decimal::abs() const {
+
+            Decimal a(*this);
+
+            a._number = _number.abs();
+
+            return a;
+        }
+
+        Decimal Decimal::inverse() const {
+            return Decimal(1) / *this;
+        }
+
+        Decimal Decimal::ceil() const {
+
+            Decimal a(*this);
+
+            a._number = divide(_number, denominator(_scale), ROUNDING_MODE::ceil) * denominator(_scale);
+
+            return a;
+        }
+
+        Decimal Decimal::floor() const {
+
+            Decimal a(*this);
+
+            a._number = divide(_number, denominator(_scale), ROUNDING_MODE::floor) * denominator(_scale);
+
+            return a;
+        }
+
+        Decimal Decimal::quantize(Size digits) const {
+
+            Decimal a(*this);
+
+            if (digits >= _scale) {
+                a.rescale(digits);
+            }
+            else {
+                a._number = divide(_number, denominator(_scale - digits), round_mode());
+                a._scale  = digits;
+            }
+
+            return a;
+        }
+
+        Decimal Decimal::gcd(const Decimal& b) const {
+            
+            if (is_defined() && b.is_defined()) {
+
+                Decimal a = rescaled();
+
+                a._number = a._number.gcd(b.rescaled()._number);
+
+                return a;
+            }
+
+            return Integer::UNDEF;
+        }
+
+        Decimal Decimal::pow(const Decimal& b) const {
+
+            if (!is_defined() || !b.is_defined()) {
+                return Integer::UNDEF;
+            }
+
+            Integer n, r;
+            b._number.div_rem(denominator(b._scale), n, r);
+
+            if (!r.is()) {
+
+                Size m = n.abs().to_integral<Size>();
+
+                if (m == 0) {
+                    return 1;
+                }
+
+                if (is_zero()) {
+                    return n.is_negative() ? Decimal(Integer::POS_INFINITY) : Decimal();
+                }
+
+                if (is_infinite()) {
+
+                    if (n.is_negative()) {
+                        return Decimal();
+                    }
+
+                    return is_negative() && (m & 1) ? Decimal(Integer::NEG_INFINITY) : Decimal(Integer::POS_INFINITY);
+                }
+
+                return correctly_rounded([this, m, &n]() { return eval_whole_pow(m, n.is_negative()); });
+            }
+
+            if (is_zero()) {
+                return b.is_positive() ? Decimal() : Decimal(Integer::POS_INFINITY);
+            }
+
+            if (is_negative()) {
+                return Integer::UNDEF;
+            }
+
+            return correctly_rounded([this, &b]() { return eval_pow(b); });
+        }
+
+        Decimal Decimal::eval_whole_pow(Size m, Boolean reciprocal) const {
+            /*
+                a^m by squaring and multiplying, or its reciprocal.  Each product adds
+                an error of a unit, which the later products multiply by up to m / |a|
+                times the result, and the reciprocal by the result again.  So the digits
+                of m, of a small |a|, and of a large result widen the working scale.
+            */
+
+            const Size scale = decimal_scale();
+
+            sys_float lg    = log10_abs();
+            sys_float whole = static_cast<sys_float>(m) * (reciprocal ? -lg : lg);
+
+            Size extra = 2;
+
+            for (Size j = m; j > 0; j /= 10) {
+                extra += 1;
+            }
+
+            extra += lg < 0 ? static_cast<Size>(-lg) : 0;
+            extra += whole > 0 ? static_cast<Size>(whole) : 0;
+
+            Decimal res = 1;
+            {
+                Decimal_Context_Guard guard(scale + extra);
+
+                Decimal a = rescaled();
+
+                res = 1;
+
+                for (Size bits = m; bits; ) {
+
+                    if (bits & 1) {
+                        res *= a;
+                    }
+
+                    bits >>= 1;
+
+                    if (bits) {
+                        a *= a;
+                    }
+                }
+
+                if (reciprocal) {
+                    res = res.inverse();
+                }
+            }
+
+            res.rescale(scale);
+
+            return res;
+        }
+
+        sys_float Decimal::log10_abs() const {
+            /*
+                log10 |a| in floating point, from the leading bits of a non zero number.
+            */
+
+            const Whole_Number a = _number.abs().get_Whole_Number();
+
+            Size bits = a.get_Binary_Register().lead_bit();
+            Size drop = bits > 53 ? bits - 53 : 0;
+
+            return std::log10(static_cast<sys_float>((a >> drop).to_integral<Whole_Number::Word>()))
+                 + static_cast<sys_float>(drop) * std::log10(2.0) - static_cast<sys_float>(_scale);
+        }
+
+        Decimal Decimal::eval_pow(const Decimal& b) const {
+            /*
+                a^b = e^(b * ln(a)).  The error of the exponent is multiplied by the
+                result, so the whole digits of the result widen the working scale.
+            */
+
+            const Size scale = decimal_scale();
+
+            Decimal y;
+            {
+                Decimal_Context_Guard guard(scale + GUARD_DIGITS);
+
+                y = b * eval_ln();
+            }
+
+            Size whole = y.is_positive() ? y.to_integral<Size>() * 4343 / 10000 + 1 : 0;
+
+            Decimal a_b;
+            {
+                Decimal_Context_Guard guard(scale + whole + GUARD_DIGITS);
+
+                a_b = whole ? (b * eval_ln()).eval_exp() : y.eval_exp();
+            }
+
+            a_b.rescale(scale);
+
+            return a_b;
+        }
+
+        Decimal Decimal::root(const Decimal& b) const {
+
+            if (!is_defined() || !b.is_defined()) {
+                return Integer::UNDEF;
+            }
+
+            Integer n, r;
+            b._number.div_rem(denominator(b._scale), n, r);
+
+            if (r.is()) {
+                // A fractional root is a power.
+                return pow(b.inverse());
+            }
+
+            Size k = n.abs().to_integral<Size>();
+
+            if (k == 0 || k > MAX_SCALE || (is_negative() && !(k & 1))) {
+                return Integer::UNDEF;
+            }
+
+            if (k == 1) {
+                return n.is_negative() ? inverse() : rescaled();
+            }
+
+            if (k == 2) {
+                return n.is_negative() ? inverse_sqrt() : sqrt();
+            }
+
+            if (is_zero()) {
+                return n.is_negative() ? Decimal(Integer::POS_INFINITY) : Decimal();
+            }
+
+            return nth_root(k, n.is_negative());
+        }
+
+        Decimal Decimal::nth_root(Size k, Boolean reciprocal) const {
+            /*
+                Write |a| = m * 10^(k e), with m in about [1, 10^k), so the root is
+                m^(1/k) * 10^e.  A reciprocal root is (10^k / m)^(1/k) * 10^(-e - 1),
+                so both take the root of a number in [1, 10^k], which lies in [1, 10].
+                The root is found GUARD_DIGITS past the scale, and rounded from those
+                digits when they are clear of a rounding boundary.  Else the candidate
+                is settled exactly, from the sign of a - r^k.
+            */
+
+            const Size    scale    = decimal_scale();
+            const Boolean positive = is_positive();
+
+            const Whole_Number a = rescaled()._number.abs().get_Whole_Number();
+
+            // The rounding of the magnitude, with ceil and floor swapped for a negative root.
+            ROUNDING_MODE mode = round_mode();
+
+            if (!positive && mode == ROUNDING_MODE::ceil) {
+                mode = ROUNDING_MODE::floor;
+            }
+            else if (!positive && mode == ROUNDING_MODE::floor) {
+                mode = ROUNDING_MODE::ceil;
+            }
+
+            sys_float lg = log10_abs();
+
+            sys_int e     = static_cast<sys_int>(std::floor(lg / static_cast<sys_float>(k)));
+            sys_int m_scl = static_cast<sys_int>(scale) + static_cast<sys_int>(k) * e;
+
+            sys_float lg_m = lg - static_cast<sys_float>(k) * static_cast<sys_float>(e);
+
+            // m = |a| / 10^(k e), exactly.
+            Decimal m;
+
+            if (m_scl >= 0) {
+                m._number = Integer(a);
+                m._scale  = static_cast<Size>(m_scl);
+            }
+            else {
+                m._number = Integer(a * Power_Cache::power(10, static_cast<Size>(-m_scl)));
+                m._scale  = 0;
+            }
+
+            const Size guard = scale + GUARD_DIGITS;   // The scale the root is found at.
+
+            sys_int shift = reciprocal ? -e - 1 : e;
+            sys_int place = static_cast<sys_int>(guard) + shift;
+
+            Size work = place > 16 ? static_cast<Size>(place) : 16;
+
+            if (reciprocal) {
+
+                Decimal_Context_Guard context(work + GUARD_DIGITS);
+
+                m    = Decimal(Integer(Power_Cache::power(10, k))) / m;
+                lg_m = static_cast<sys_float>(k) - lg_m;
+            }
+
+            Decimal r = newton_root(m, k, work, std::pow(10.0, lg_m / static_cast<sys_float>(k)));
+
+            // The root held at 'guard', so z = r * 10^(guard + shift - work).
+            Integer z = r._number;
+
+            if (place >= static_cast<sys_int>(work)) {
+                z *= Integer(Power_Cache::power(10, static_cast<Size>(place) - work));
+            }
+            else {
+                z /= Integer(Power_Cache::power(10, static_cast<Size>(static_cast<sys_int>(work) - place)));
+            }
+
+            const Integer unit  = denominator(GUARD_DIGITS);
+            const Integer error = denominator(GUARD_DIGITS / 2);
+
+            Integer q = divide(z - error, unit, mode);
+
+            if (q != divide(z + error, unit, mode)) {
+
+                // Compare the candidate x / (h 10^scale) with the root, as a power.
+                auto compare_root = [&](const Integer& x, Size h) -> sys_float {
+
+                    Whole_Number x_k = x.get_Whole_Number().pow(k);
+                    Whole_Number h_k = Whole_Number(1) << (h == 2 ? k : 0);
+
+                    if (reciprocal) {
+                        return (x_k * a).compare(h_k * Power_Cache::power(10, scale * (k + 1)));
+                    }
+
+                    return x_k.compare(a * h_k * Power_Cache::power(10, scale * (k - 1)));
+                };
+
+                q = z / unit;
+
+                while (compare_root(q + ONE, 1) <= 0) {
+                    ++q;
+                }
+
+                while (q.is() && compare_root(q, 1) > 0) {
+                    --q;
+                }
+
+                if (compare_root(q, 1) != 0) {
+
+                    sys_float half = compare_root(q + q + ONE, 2);     // The midpoint against the root.
+
+                    Boolean away = false;
+
+                    switch (mode) {
+
+                    case ROUNDING_MODE::ceil:
+                    case ROUNDING_MODE::away_from_zero:
+                        away = true;
+                        break;
+
+                    case ROUNDING_MODE::half_up:
+                        away = half <= 0;
+                        break;
+
+                    case ROUNDING_MODE::half_down:
+                        away = half < 0;
+                        break;
+
+                    case ROUNDING_MODE::half_even:
+                        away = half < 0 || (half == 0 && q.is_odd());
+                        break;
+
+                    case ROUNDING_MODE::half_odd:
+                        away = half < 0 || (half == 0 && q.is_even());
+                        break;
+
+                    default:
+                        away = false;
+                    }
+
+                    if (away) {
+                        ++q;
+                    }
+                }
+            }
+
+            Decimal root;
+
+            root._number = positive ? q : -q;
+            root._scale  = scale;
+
+            return root;
+        }
+
+        Decimal Decimal::newton_root(const Decimal& m, Size k, Size scale, sys_float start) {
+            /*
+                m^(1/k) at 'scale', for m in about [1, 10^k], from the root 'start' found in
+                floating point.  The step r' = ((k - 1) r + m / r^(k - 1)) / k doubles the
+                correct digits, less about the digits of k, so each level runs at half the
+                scale of the next, plus those digits.  The first level repeats the step
+                until it settles.
+            */
+
+            Size lost = 2;
+
+            for (Size j = k; j > 0; j /= 10) {
+                lost += 1;
+            }
+
+            std::vector<Size> levels;
+
+            Size p = scale;
+
+            while (p > 2 * lost + 4) {
+                levels.push_back(p);
+                p = p / 2 + lost;
+            }
+
+            levels.push_back(p);
+
+            // The root and m as whole numbers of units at a scale, moved between scales by truncation.
+            auto at = [](const Integer& x, Size from, Size to) {
+                return to >= from ? x * Integer(Power_Cache::power(10, to - from))
+                                  : x / Integer(Power_Cache::power(10, from - to));
+            };
+
+            Integer r = Integer(static_cast<sys_int>(start * 1e15));
+            Size    r_scale = 15;
+
+            auto step = [&](Size work) {
+
+                const Integer unit(Power_Cache::power(10, work));
+
+                Integer x = at(r, r_scale, work);
+
+                // x^(k - 1) by squaring, each product truncated to the scale.
+                Integer power = unit;
+                Integer base  = x;
+
+                for (Size j = k - 1; j > 0; j >>= 1) {
+
+                    if (j & 1) {
+                        power = power * base / unit;
+                    }
+
+                    if (j > 1) {
+                        base = base * base / unit;
+                    }
+                }
+
+                Integer next = at(m._number, m._scale, work) * unit / power;
+
+                next += x * Integer(static_cast<sys_int>(k - 1));
+                next /= static_cast<sys_int>(k);
+
+                Boolean settled = (next - x).abs() <= ONE;
+
+                r       = std::move(next);
+                r_scale = work;
+
+                return settled;
+            };
+
+            for (Size i = 0; i < 100 && !step(levels.back() + lost); ++i) {}
+
+            for (Size i = levels.size() - 1; i-- > 0; ) {
+                step(levels[i] + lost);
+            }
+
+            Decimal root;
+
+            root._number = at(r, r_scale, scale);
+            root._scale  = scale;
+
+            return root;
+        }
+
+        Decimal Decimal::sqrt() const {
+
+            if (!is_defined() || is_negative()) {
+                return Integer::UNDEF;
+            }
+
+            Decimal a = rescaled();
+
+            Integer n = a._number * denominator();
+
+            a._number = n.sqrt();
+
+            // Round from the remainder n - s^2; a root never falls exactly on a half.
+
+            Integer rem = n - a._number * a._number;
+
+            if (rem.is()) {
+
+                switch (round_mode()) {
+
+                case ROUNDING_MODE::toward_zero:
+                case ROUNDING_MODE::floor:
+                    break;
+
+                case ROUNDING_MODE::ceil:
+                case ROUNDING_MODE::away_from_zero:
+                    ++a._number;
+                    break;
+
+                default:
+                    if (rem > a._number) {
+                        ++a._number;
+                    }
+                }
+            }
+
+            return a;
+        }
+
+        Decimal Decimal::inverse_sqrt() const {
+
+            if (!is_defined() || !is_positive()) {
+                return is_zero() ? Integer::POS_INFINITY : Integer::UNDEF;
+            }
+
+            return correctly_rounded([this]() { return sqrt().inverse(); });
+        }
+
+        Decimal Decimal::hypot(const Decimal& b) const {
+
+            return (operator*(*this) + (b * b)).sqrt();
+        }
+
+        Decimal Decimal::hypot(const Decimal& b, const Decimal& c) const {
+
+            return (operator*(*this) + (b * b) + (c * c)).sqrt();
+        }
+
+        Decimal Decimal::exp() const {
+            return correctly_rounded([this]() { return eval_exp(); });
+        }
+
+        Decimal Decimal::eval_exp() const {
+
+            if (!is_finite()) {
+
+                if (is_infinite() && is_negative()) {
+                    return Decimal();
+                }
+
+                return *this;
+            }
+
+            if (is_zero()) {
+                return 1;
+            }
+
+            /*
+                Write x = k * ln(2) + r, with |r| < ln(2), so e^x = 2^k * e^r.  Then r is
+                halved a few more times, so the series needs only a handful of terms, and
+                the sum is squared back.  The error of e^r is multiplied by 2^k and by each
+                squaring, so those digits and the digits of k widen the working scale.
+            */
+
+            const Size scale = decimal_scale();
+
+            Decimal x = rescaled();
+
+            Integer k = x._number / integer_ln2();
+
+            if (k.abs() > Integer(MAX_SCALE) * Integer(10) / Integer(3)) {
+                return k.is_negative() ? Decimal() : Decimal(Integer::POS_INFINITY);
+            }
+
+            Size bits  = k.abs().to_integral<Size>();
+            Size whole = k.is_negative() ? 0 : bits * 30103 / 100000 + 1;
+
+            if (k.is_negative() && bits * 30103 / 100000 > scale + 1) {
+                return Decimal();
+            }
+
+            Size k_digits = 1;
+
+            for (Size n = bits; n >= 10; n /= 10) {
+                k_digits += 1;
+            }
+
+            Size halvings = static_cast<Size>(std::sqrt(static_cast<double>(scale)));
+
+            Decimal e_x;
+            {
+                Decimal_Context_Guard guard(scale + whole + k_digits + halvings / 3 + GUARD_DIGITS);
+
+                Decimal r = x - Decimal(k) * decimal_ln2();
+
+                r._number /= TWO.pow(halvings);
+
+                e_x = r.get_exp();
+
+                for (Size i = 0; i < halvings; ++i) {
+                    e_x *= e_x;
+                }
+
+                if (k.is_negative()) {
+                    e_x._number /= TWO.pow(bits);
+                }
+                else {
+                    e_x._number *= TWO.pow(bits);
+                }
+            }
+
+            e_x.rescale(scale);
+
+            return e_x;
+        }
+
+        Decimal Decimal::ln() const {
+            return correctly_rounded([this]() { return eval_ln(); });
+        }
+
+        Decimal Decimal::eval_ln() const {
+
+            if (!is_defined() || !is_positive()) {
+                return is_zero() ? Integer::NEG_INFINITY : Integer::UNDEF;
+            }
+
+            if (_scale != decimal_scale()) {
+                return rescaled().eval_ln();
+            }
+
+            if ((_number == denominator())) {
+                return Decimal();
+            }
+            else if ((_number == integer_e())) {
+                return Decimal(1);
+            }
+
+            if (_scale >= AGM_SCALE) {
+                return get_agm_ln();
+            }
+
+            if ((_number > denominator())) {
+                /*
+                    Factor out the power of 2.  Then get ln().
+                    This greatly improves speed of convergance.
+                */
+
+                Size  exp = (_number / denominator()).get_Whole_Number().get_Binary_Register().lead_bit() - 1;
+                Integer x = _number.get_Whole_Number() >> exp;
+
+                Decimal r;
+                r._number = x;
+
+                // return ln(x) + ln(2) * exp, the product exact at the scale of ln(2).
+                Decimal l = decimal_ln2();
+                l._number *= static_cast<sys_int>(exp);
+
+                return (r.get_ln() + l);
+            }
+
+            if ((_number + _number < denominator())) {
+                // ln(x) = -ln(1/x), as the series converges slowly near zero.
+                return -inverse().eval_ln();
+            }
+
+            return get_ln();
+        }
+
+        Decimal Decimal::log2() const {
+            return log(Decimal(2));
+        }
+
+        Decimal Decimal::log10() const {
+            return log(Decimal(10));
+        }
+
+        Decimal Decimal::log(const Decimal& b) const {
+
+            if (!is_defined() || !is_positive() || !b.is_defined() || !b.is_positive()) {
+                return Integer::UNDEF;
+            }
+
+            // An exact result, such as log10(1000), is settled by the rounding.
+            return correctly_rounded([this, &b]() { return eval_ln() / b.eval_ln(); });
+        }
+
+        Decimal Decimal::sin() const {
+
+            Decimal sin_x, cos_x;
+
+            sincos(sin_x, cos_x);
+
+            return sin_x;
+        }
+
+        Decimal Decimal::cos() const {
+
+            Decimal sin_x, cos_x;
+
+            sincos(sin_x, cos_x);
+
+            return cos_x;
+        }
+
+        Decimal Decimal::tan() const {
+
+            return correctly_rounded([this]() {
+
+                Decimal sin_x, cos_x;
+
+                eval_sincos(sin_x, cos_x);
+
+                return sin_x / cos_x;
+            });
+        }
+
+        void Decimal::sincos(Decimal& sin_x, Decimal& cos_x) const {
+            correctly_rounded(sin_x, cos_x, [this](Decimal& s, Decimal& c) { eval_sincos(s, c); });
+        }
+
+        void Decimal::eval_sincos(Decimal& sin_x, Decimal& cos_x) const {
+
+            if (!is_finite()) {
+                sin_x = Integer::UNDEF;
+                cos_x = Integer::UNDEF;
+                return;
+            }
+
+            const Size scale = decimal_scale();
+            {
+                Decimal_Context_Guard guard(scale + GUARD_DIGITS);
+
+                // Take whole turns out exactly, then convert to radians.
+
+                Decimal x = rescaled();
+
+                x._number %= decimal_360()._number;
+
+                (x * decimal_pi() / decimal_180()).eval_radian_sincos(sin_x, cos_x);
+            }
+
+            sin_x.rescale(scale);
+            cos_x.rescale(scale);
+        }
+
+        Decimal Decimal::radian_sin() const {
+
+            Decimal sin_x, cos_x;
+
+            radian_sincos(sin_x, cos_x);
+
+            return sin_x;
+        }
+
+        Decimal Decimal::radian_cos() const {
+
+            Decimal sin_x, cos_x;
+
+            radian_sincos(sin_x, cos_x);
+
+            return cos_x;
+        }
+
+        Decimal Decimal::radian_tan() const {
+
+            return correctly_rounded([this]() {
+
+                Decimal sin_x, cos_x;
+
+                eval_radian_sincos(sin_x, cos_x);
+
+                return sin_x / cos_x;
+            });
+        }
+
+        void Decimal::radian_sincos(Decimal& sin_x, Decimal& cos_x) const {
+            correctly_rounded(sin_x, cos_x, [this](Decimal& s, Decimal& c) { eval_radian_sincos(s, c); });
+        }
+
+        void Decimal::eval_radian_sincos(Decimal& sin_x, Decimal& cos_x) const {
+
+            if (!is_finite()) {
+                sin_x = Integer::UNDEF;
+                cos_x = Integer::UNDEF;
+                return;
+            }
+
+            /*
+                Write x = k * pi/2 + r, with |r| <= pi/4, and take the quadrant from k.  The
+                cached pi is held to the whole digits of x past the working scale, so r is
+                exact to the scale however large x is.  Then r is halved a few times before
+                the series, and the double angle formulas are applied on the way back.
+            */
+
+            const Size scale = decimal_scale();
+
+            Size whole_bits = (_number / denominator(_scale)).get_Whole_Number().get_Binary_Register().lead_bit();
+            Size whole      = whole_bits * 30103 / 100000 + 1;
+            Size halvings   = static_cast<Size>(std::sqrt(static_cast<double>(scale))) / 2;
+
+            {
+                Decimal_Context_Guard guard(scale + whole + halvings / 3 + GUARD_DIGITS);
+
+                Decimal x = rescaled();
+
+                Integer half_pi = integer_pi() / TWO;
+
+                Integer k, r;
+                x._number.div_rem(half_pi, k, r);
+
+                if (r.abs() + r.abs() > half_pi) {
+
+                    if (r.is_negative()) {
+                        k -= ONE;
+                        r += half_pi;
+                    }
+                    else {
+                        k += ONE;
+                        r -= half_pi;
+                    }
+                }
+
+                Decimal y;
+
+                y._number = r / TWO.pow(halvings);
+
+                Decimal s, c;
+                y.get_sincos(s, c);
+
+                for (Size i = 0; i < halvings; ++i) {
+
+                    Decimal s2 = s * c;
+
+                    s2._number *= TWO;
+
+                    c = Decimal(1) - s * s - s * s;
+                    s = s2;
+                }
+
+                switch (((k % Integer(4)).to_integral<sys_int>() + 4) % 4) {
+
+                case 1:
+                    sin_x =  c;
+                    cos_x = -s;
+                    break;
+
+                case 2:
+                    sin_x = -s;
+                    cos_x = -c;
+                    break;
+
+                case 3:
+                    sin_x = -c;
+                    cos_x =  s;
+                    break;
+
+                default:
+                    sin_x = s;
+                    cos_x = c;
+                }
+            }
+
+            sin_x.rescale(scale);
+            cos_x.rescale(scale);
+        }
+
+        Decimal Decimal::asin() const {
+            return correctly_rounded([this]() { return eval_asin(); });
+        }
+
+        Decimal Decimal::eval_asin() const {
+
+            Decimal asin_x = abs();
+
+            Boolean neg = is_negative() ? true : false;
+
+            /*
+                First reduce value closure to 0.5
+                to improve speed of convergance.
+            */
+
+            sys_int power_of_2 = 0;
+
+            const Decimal limit = 0.5_dec;
+            Decimal one(ONE);
+            Decimal two(TWO);
+
+            if (asin_x > one) {
+                return Integer::UNDEF;
+            }
+
+            while (asin_x > limit) {
+                // sin(t/2) = sqrt((1 - cos(t)) / 2).
+                asin_x = ((one - (one - asin_x * asin_x).sqrt()) / two).sqrt();
+
+                power_of_2 += 1;
+            }
+
+            asin_x = asin_x.get_asin() * two.pow(power_of_2);
+
+            return neg ? -asin_x : asin_x;
+        }
+
+        Decimal Decimal::acos() const {
+            return correctly_rounded([this]() { return (decimal_pi() / 2) - eval_asin(); });
+        }
+
+        Decimal Decimal::atan() const {
+            return correctly_rounded([this]() { return eval_atan(); });
+        }
+
+        Decimal Decimal::eval_atan() const {
+
+            Decimal sinh_x = abs();
+
+            Boolean neg = is_negative() ? true : false;
+
+            /*
+                First reduce value closure to 0.5
+                to improve speed of convergance.
+            */
+
+            sys_int power_of_2 = 0;
+
+            const Decimal limit = 0.1_dec;
+            Decimal one(ONE);
+            Decimal two(TWO);
+
+            while (sinh_x > limit) {
+
+                sinh_x = sinh_x / (one + (one + sinh_x * sinh_x).sqrt());
+
+                power_of_2 += 1;
+            }
+
+            sinh_x = sinh_x.get_atan() * two.pow(power_of_2);
+
+            return neg ? -sinh_x : sinh_x;
+        }
+
+        Decimal Decimal::sinh() const {
+            return correctly_rounded([this]() { return eval_sinh(); });
+        }
+
+        Decimal Decimal::eval_sinh() const {
+
+            if (!is_finite()) {
+                return *this;
+            }
+
+            const Size scale = decimal_scale();
+
+            Decimal sinh_x;
+            {
+                Decimal_Context_Guard guard(scale + GUARD_DIGITS);
+
+                Decimal e_x = eval_exp();
+
+                sinh_x = e_x - e_x.inverse();
+
+                sinh_x._number /= TWO;
+            }
+
+            sinh_x.rescale(scale);
+
+            return sinh_x;
+        }
+
+        Decimal Decimal::cosh() const {
+            return correctly_rounded([this]() { return eval_cosh(); });
+        }
+
+        Decimal Decimal::eval_cosh() const {
+
+            if (!is_finite()) {
+                return is_nan() ? *this : Decimal(Integer::POS_INFINITY);
+            }
+
+            const Size scale = decimal_scale();
+
+            Decimal cosh_x;
+            {
+                Decimal_Context_Guard guard(scale + GUARD_DIGITS);
+
+                Decimal e_x = eval_exp();
+
+                cosh_x = e_x + e_x.inverse();
+
+                cosh_x._number /= TWO;
+            }
+
+            cosh_x.rescale(scale);
+
+            return cosh_x;
+        }
+
+        Decimal Decimal::tanh() const {
+            return correctly_rounded([this]() { return eval_tanh(); });
+        }
+
+        Decimal Decimal::eval_tanh() const {
+
+            if (!is_finite()) {
+                return is_nan() ? *this : Decimal(is_negative() ? -1 : 1);
+            }
+
+            /*
+                tanh(|x|) = (1 - e^(-2|x|)) / (1 + e^(-2|x|)), which stays finite for any x.
+            */
+
+            const Size scale = decimal_scale();
+
+            Decimal tanh_x;
+            {
+                Decimal_Context_Guard guard(scale + GUARD_DIGITS);
+
+                Decimal one(ONE);
+
+                Decimal e_x = (abs() * Decimal(-2)).eval_exp();
+
+                tanh_x = (one - e_x) / (one + e_x);
+            }
+
+            tanh_x.rescale(scale);
+
+            return is_negative() ? -tanh_x : tanh_x;
+        }
+
+        Decimal Decimal::asinh() const {
+            return correctly_rounded([this]() { return (*this + (*this * *this + 1).sqrt()).eval_ln(); });
+        }
+
+        Decimal Decimal::acosh() const {
+            return correctly_rounded([this]() { return (*this + (*this * *this - 1).sqrt()).eval_ln(); });
+        }
+
+        Decimal Decimal::atanh() const {
+
+            return correctly_rounded([this]() {
+
+                Decimal half = ((Decimal(1) + *this) / (Decimal(1) - *this)).eval_ln();
+
+                half._number /= TWO;
+
+                return half;
+            });
+        }
+
+        Text Decimal::sign() const {
+            return _number.sign();
+        }
+
+        Text Decimal::to_string() const {
+            return to_string(10, -1);
+        }
+
+        Text Decimal::to_string(Size base, sys_int sign) const {
+            /*
+                Convert the number once, and place the point within its digits.
+            */
+
+            if (!_number.is_finite()) {
+                return _number.to_string();
+            }
+
+            Text digits = _number.to_string(0, 0);
+
+            if (digits.size() <= _scale) {
+
+                digits.insert(0, _scale + 1 - digits.size(), '0');
+            }
+
+            const Size point = digits.size() - _scale;
+
+            Text result = is_negative() ? "-" : "";
+
+            result.append(digits, 0, point);
+
+            if (digits.find_first_not_of('0', point) != Text::npos) {
+                result += "." + digits.substr(point);
+            }
+            else {
+                result += ".0";
+            }
+
+            return result;
+        }
+
+        void Decimal::write_digits(std::ostream& out) const {
+            write_digits([&out](const Char* text, Size length) { out.write(text, length); });
+        }
+
+        void Decimal::write_digits(FILE* file) const {
+            write_digits([file](const Char* text, Size length) { std::fwrite(text, 1, length, file); });
+        }
+
+        Decimal Decimal::read_digits(std::istream& in) {
+
+            Boolean negative = false;
+
+            std::istream::sentry ready(in);
+
+            if (ready && (in.peek() == '-' || in.peek() == '+')) {
+                negative = in.get() == '-';
+            }
+
+            Size count = 0;
+
+            Whole_Number n = Whole_Number::read_digits(in, 10);
+
+            if (in && in.peek() == '.') {
+
+                in.get();
+
+                if (std::isdigit(in.peek())) {
+                    Whole_Number fraction = Whole_Number::read_digits(in, 10, count);
+
+                    n = n * Power_Cache::power(10, count) + fraction;
+                }
+            }
+
+            Decimal a;
+
+            a._number = negative ? -Integer(n) : Integer(n);
+            a._scale  = count;
+
+            a.rescale(decimal_scale());
+
+            return a;
+        }
+
+        void Decimal::write_digits(const Whole_Number::Digit_Sink& sink) const {
+            /*
+                Stream the digits of the number with the point placed 'scale' digits
+                from their end.  The digit count, from the bit length and at most one
+                power of ten, places the point before any digit is passed on.  Zeros
+                of the fraction are held back as a count, until a later digit shows
+                whether the fraction is all zeros, and so written as ".0".
+            */
+
+            static const Text ZEROS(256, '0');
+
+            if (!_number.is_finite()) {
+
+                Text text = _number.to_string();
+
+                sink(text.data(), text.size());
+
+                return;
+            }
+
+            const Whole_Number& n = _number.get_Whole_Number();
+
+            const Size   bits = n.get_Binary_Register().lead_bit();
+            const double l2   = std::log10(2.0);
+
+            Size count = 1;
+
+            if (bits > 0) {
+
+                Size low  = static_cast<Size>(std::floor(static_cast<double>(bits - 1) * l2));
+                Size high = static_cast<Size>(std::floor(static_cast<double>(bits) * l2));
+
+                count = high + 1;
+
+                if (low != high && n < Power_Cache::power(10, high)) {
+                    count = high;
+                }
+            }
+
+            if (is_negative()) {
+                sink("-", 1);
+            }
+
+            const Size integral = (count > _scale) ? count - _scale : 0;
+
+            Size    seen  = 0;      // The integral digits passed on.
+            Size    zeros = 0;      // The fraction zeros held back.
+            Boolean any   = false;  // Whether a non zero fraction digit was passed on.
+
+            auto put_zeros = [&]() {
+
+                while (zeros > 0) {
+
+                    Size piece = (zeros < ZEROS.size()) ? zeros : ZEROS.size();
+
+                    sink(ZEROS.data(), piece);
+
+                    zeros -= piece;
+                }
+            };
+
+            if (integral == 0) {
+                sink("0.", 2);
+
+                zeros = _scale - count;
+            }
+
+            n.write_digits([&](const Char* text, Size length) {
+
+                if (seen < integral) {
+
+                    Size take = (length < integral - seen) ? length : integral - seen;
+
+                    sink(text, take);
+
+                    seen   += take;
+                    text   += take;
+                    length -= take;
+
+                    if (seen == integral) {
+                        sink(".", 1);
+                    }
+                }
+
+                Size last = length;
+
+                while (last > 0 && text[last - 1] == '0') {
+                    last -= 1;
+                }
+
+                if (last > 0) {
+
+                    put_zeros();
+
+                    sink(text, last);
+
+                    any = true;
+                }
+
+                zeros += length - last;
+            });
+
+            if (any) {
+                put_zeros();
+            }
+            else {
+                sink("0", 1);
+            }
+        }
+
+        const Integer& Decimal::get_Integer() const {
+            return _number;
+        }
+
+        Size Decimal::get_scale() const {
+            return _scale;
+        }
+
+        Boolean Decimal::align(const Decimal& b) {
+            /*
+                Bring this number to the working scale of the thread's context, and
+                report whether 'b' is held at it as well.
+            */
+            rescale(decimal_scale());
+
+            return b._scale == _scale;
+        }
+
+        Decimal Decimal::rescaled() const {
+
+            Decimal a(*this);
+
+            a.rescale(decimal_scale());
+
+            return a;
+        }
+
+        void Decimal::rescale(Size scale) {
+
+            if (_scale == scale) {
+                return;
+            }
+
+            if (scale > _scale) {
+                _number *= denominator(scale - _scale);
+            }
+            else {
+                _number = divide(_number, denominator(_scale - scale), round_mode());
+            }
+
+            _scale = scale;
+        }
+
+        Integer Decimal::divide(const Integer& n, const Integer& d, ROUNDING_MODE mode) {
+            /*
+                The quotient n / d rounded by the mode, from the truncated quotient
+                and the remainder of a single division.
+            */
+
+            Integer q, r;
+            n.div_rem(d, q, r);
+
+            if (!r.is()) {
+                return q;
+            }
+
+            return round_quotient(q, r, d.get_Whole_Number(), n.is_negative() == d.is_negative(), mode);
+        }
+
+        Integer Decimal::divide(const Integer& n, const Divisor& d, ROUNDING_MODE mode) {
+            /*
+                As above, by a divisor prepared for repeated division.  The quotient is
+                truncated toward zero, and the remainder takes the sign of 'n'.
+            */
+
+            if (!n.is_finite() || !d.is()) {
+                return divide(n, Integer(d.get_Whole_Number()), mode);
+            }
+
+            Whole_Number q, r;
+            d.div_rem(n.get_Whole_Number(), q, r);
+
+            Integer qot(q);
+            Integer rem(r);
+
+            if (n.is_negative()) {
+                qot = -qot;
+                rem = -rem;
+            }
+
+            if (!rem.is()) {
+                return qot;
+            }
+
+            return round_quotient(qot, rem, d.get_Whole_Number(), !n.is_negative(), mode);
+        }
+
+        Integer Decimal::round_quotient(Integer q, const Integer& r, const Whole_Number& d, Boolean positive, ROUNDING_MODE mode) {
+            /*
+                Round the truncated quotient 'q' of a division by 'd', whose remainder 'r' is
+                not zero.  'positive' is the sign of the exact quotient.
+            */
+
+            sys_float half = (r.get_Whole_Number() << 1).compare(d);  // The remainder against half of d.
+
+            Boolean away = false;                                      // Step away from zero.
+
+            switch (mode) {
+
+            case ROUNDING_MODE::away_from_zero:
+                away = true;
+                break;
+
+            case ROUNDING_MODE::ceil:
+                away = positive;
+                break;
+
+            case ROUNDING_MODE::floor:
+                away = !positive;
+                break;
+
+            case ROUNDING_MODE::half_up:
+                away = half >= 0;
+                break;
+
+            case ROUNDING_MODE::half_down:
+                away = half > 0;
+                break;
+
+            case ROUNDING_MODE::half_even:
+                away = half > 0 || (half == 0 && q.is_odd());
+                break;
+
+            case ROUNDING_MODE::half_odd:
+                away = half > 0 || (half == 0 && q.is_even());
+                break;
+
+            default:
+                away = false;
+            }
+
+            if (away) {
+
+                if (positive) {
+                    ++q;
+                }
+                else {
+                    --q;
+                }
+            }
+
+            return q;
+        }
+
+        Boolean Decimal::round_settled(Decimal& a, Decimal& b, Size scale, Size guard, Boolean last) {
+            /*
+                The values are held at 'guard' digits past the scale, and are within
+                10^(guard / 2) units of their last digit.  They settle when both ends of
+                that interval round to the same value at the scale.  An exact result, or
+                a tie, sits on a rounding boundary and never settles, so on a retry a
+                value that is still within its error of a boundary is taken to be on it.
+                Then, or when this is the last attempt, both are rounded to the scale.
+            */
+
+            const ROUNDING_MODE mode  = round_mode();
+            const Integer       unit  = denominator(guard);
+            const Integer       half  = unit / TWO;
+            const Integer       error = denominator(guard / 2);
+
+            Decimal* values[] = { &a, &b };
+
+            for (Decimal* x : values) {
+
+                if (!x->is_finite()) {
+                    continue;
+                }
+
+                x->rescale(scale + guard);
+
+                if (last || divide(x->_number - error, unit, mode) == divide(x->_number + error, unit, mode)) {
+                    continue;
+                }
+
+                if (guard == GUARD_DIGITS) {
+                    return false;
+                }
+
+                // The nearest boundary, a whole or a half unit at the scale.
+                Integer boundary = divide(x->_number, half, ROUNDING_MODE::half_even) * half;
+
+                if ((x->_number - boundary).abs() > error) {
+                    return false;
+                }
+
+                x->_number = boundary;
+            }
+
+            for (Decimal* x : values) {
+
+                if (x->is_finite()) {
+                    x->_number = divide(x->_number, unit, mode);
+                    x->_scale  = scale;
+                }
+            }
+
+            return true;
+        }
+
+        Decimal Decimal::get_exp() const {
+            /*
+                The Taylor Series of e^x, for a small x.
+            */
+
+            Series_Factor p = [](Size)   -> Size { return 1; };
+            Series_Factor q = [](Size k) -> Size { return k; };
+
+            Decimal x = rescaled();
+
+            Size terms = series_terms(x, p, q);
+
+            return sum_series(series_powers(x, terms), terms, p, q);
+        }
+
+        Decimal Decimal::get_agm_ln() const {
+            /*
+                For a large s, ln(s) = pi / (2 * AGM(1, 4 / s)) with a relative error near
+                4 / s^2.  So x is doubled m times, until s = x * 2^m passes the square root
+                of the working precision, and ln(x) = ln(s) - m * ln(2).  As 4 / s is held
+                to the full precision, the working scale is widened by half.
+            */
+
+            const Size scale = decimal_scale();
+            const Size bits  = (scale + GUARD_DIGITS) * 3322 / 1000 + 1;
+
+            sys_int x_bits = static_cast<sys_int>(_number.get_Whole_Number().get_Binary_Register().lead_bit());
+            sys_int d_bits = static_cast<sys_int>(denominator().get_Whole_Number().get_Binary_Register().lead_bit());
+
+            sys_int shift = static_cast<sys_int>(bits / 2 + 2) - (x_bits - d_bits);
+
+            Size m = shift > 0 ? static_cast<Size>(shift) : 0;
+
+            Decimal ln_x;
+            {
+                Decimal_Context_Guard guard(scale + (bits / 2) * 30103 / 100000 + GUARD_DIGITS);
+
+                Decimal s = rescaled();
+
+                s._number *= TWO.pow(m);
+
+                Decimal a(ONE);
+                Decimal b = Decimal(4) / s;
+
+                // Each step doubles the digits a and b agree to.
+
+                while ((a._number - b._number).abs() > ONE) {
+
+                    Decimal c = a + b;
+
+                    c._number /= TWO;
+
+                    b._number = (a._number * b._number).sqrt();
+
+                    a = c;
+                }
+
+                ln_x = decimal_pi() / (a + a) - decimal_ln2() * Decimal(static_cast<sys_int>(m));
+            }
+
+            ln_x.rescale(scale);
+
+            return ln_x;
+        }
+
+        Decimal Decimal::get_ln() const {
+            /*
+                ln(x) = 2 * atanh(z) with z = (x - 1) / (x + 1), and
+                atanh(z) = z * (1 + z^2/3 + z^4/5 + ...).
+            */
+
+            Series_Factor p = [](Size k) -> Size { return 2 * k - 1; };
+            Series_Factor q = [](Size k) -> Size { return 2 * k + 1; };
+
+            Decimal one(ONE);
+
+            Decimal z = (*this - one) / (*this + one);
+            Decimal y = z * z;
+
+            Size terms = series_terms(y, p, q);
+
+            Decimal ln_x = z * sum_series(series_powers(y, terms), terms, p, q);
+
+            ln_x._number *= TWO;
+
+            return ln_x;
+        }
+
+        void Decimal::get_sincos(Decimal& sin_x, Decimal& cos_x) const {
+            /*
+                With y = -x^2, sin(x) = x * (1 + y/(2*3) + y^2/(2*3*4*5) + ...) and
+                cos(x) = 1 + y/(1*2) + y^2/(1*2*3*4) + ....  Both series share the
+                powers of y, so the pair costs little more than one of them.
+            */
+
+            Series_Factor p     = [](Size)   -> Size { return 1; };
+            Series_Factor q_sin = [](Size k) -> Size { return (2 * k) * (2 * k + 1); };
+            Series_Factor q_cos = [](Size k) -> Size { return (2 * k - 1) * (2 * k); };
+
+            Decimal x = rescaled();
+            Decimal y = -(x * x);
+
+            Size sin_terms = series_terms(y, p, q_sin);
+            Size cos_terms = series_terms(y, p, q_cos);
+
+            std::vector<Decimal> powers = series_powers(y, std::max(sin_terms, cos_terms));
+
+            sin_x = x * sum_series(powers, sin_terms, p, q_sin);
+            cos_x =     sum_series(powers, cos_terms, p, q_cos);
+        }
+
+        Decimal Decimal::get_asin() const {
+            /*
+                asin(x) = x * (1 + (1/2)x^2/3 + (1*3/(2*4))x^4/5 + ...).
+            */
+
+            Series_Factor p = [](Size k) -> Size { return (2 * k - 1) * (2 * k - 1); };
+            Series_Factor q = [](Size k) -> Size { return (2 * k) * (2 * k + 1); };
+
+            Decimal x = rescaled();
+            Decimal y = x * x;
+
+            Size terms = series_terms(y, p, q);
+
+            return x * sum_series(series_powers(y, terms), terms, p, q);
+        }
+
+        Decimal Decimal::get_atan() const {
+            /*
+                atan(x) = x * (1 - x^2/3 + x^4/5 - ...).
+            */
+
+            Series_Factor p = [](Size k) -> Size { return 2 * k - 1; };
+            Series_Factor q = [](Size k) -> Size { return 2 * k + 1; };
+
+            Decimal x = rescaled();
+            Decimal y = -(x * x);
+
+            Size terms = series_terms(y, p, q);
+
+            return x * sum_series(series_powers(y, terms), terms, p, q);
+        }
+
+        Size Decimal::series_terms(const Decimal& x, Series_Factor p, Series_Factor q) {
+            /*
+                The number of terms of the series sum(c_k * x^k), with c_0 = 1 and
+                c_k = c_(k-1) * p(k) / q(k), before a term falls below the least digit
+                of the scale.  The size of x is bounded from its bit length.
+            */
+
+            if (!x.is()) {
+                return 1;
+            }
+
+            const Size scale = x._scale;
+
+            sys_float x_bits = static_cast<sys_float>(x._number.get_Whole_Number().get_Binary_Register().lead_bit());
+            sys_float d_bits = static_cast<sys_float>(denominator(scale).get_Whole_Number().get_Binary_Register().lead_bit());
+
+            sys_float log_x     = (x_bits - d_bits + 1) * 0.30103;
+            sys_float log_term  = 0;
+            sys_float log_limit = -static_cast<sys_float>(scale + 2);
+
+            Size limit = 8 * (scale + 2) + 64;      // Only reached by a series that does not converge.
+
+            Size k = 1;
+
+            while (log_term > log_limit && k < limit) {
+
+                log_term += log_x + std::log10(static_cast<sys_float>(p(k))) - std::log10(static_cast<sys_float>(q(k)));
+
+                k += 1;
+            }
+
+            return k;
+        }
+
+        std::vector<Decimal> Decimal::series_powers(const Decimal& x, Size terms) {
+            /*
+                The powers x^0 through x^m, for blocks of m terms with m near the
+                square root of the number of terms.
+            */
+
+            Size m = static_cast<Size>(std::sqrt(static_cast<double>(terms)));
+
+            m = m ? m : 1;
+
+            std::vector<Decimal> powers;
+            powers.reserve(m + 1);
+
+            powers.push_back(Decimal(1));
+            powers.back().rescale(x._scale);
+
+            for (Size i = 1; i <= m; ++i) {
+                powers.push_back(powers.back() * x);
+            }
+
+            return powers;
+        }
+
+        Decimal Decimal::sum_series(const std::vector<Decimal>& powers, Size terms, Series_Factor p, Series_Factor q) {
+            /*
+                Sum c_k * x^k, with c_0 = 1 and c_k = c_(k-1) * p(k) / q(k), by rectangular
+                splitting.  The terms are taken in blocks of m, j being the block.  Over the
+                common denominator D_j of a block, each coefficient is a product of small
+                integers, so a block sum costs only multiplications by short numbers:
+
+                    B_j = sum(x^i * N_(j,i)),  i < m.
+
+                The blocks are then joined from the last, by Horner's rule in x^m:
+
+                    A_j = B_j + x^m * A_(j+1) * P_j / (q((j+1)m) * D_(j+1)),
+
+                where P_j is the product of p over the block, and the sum is A_0 / D_0.
+                This takes about 2 * sqrt(terms) full length multiplications.
+            */
+
+            const Size    m     = powers.size() - 1;
+            const Size    scale = powers[0]._scale;
+            const Integer& den  = denominator(scale);
+
+            Size blocks = (terms + m - 1) / m;
+
+            blocks = blocks ? blocks : 1;
+
+            auto factor = [](Size value) -> Integer {
+                return Integer(Whole_Number(static_cast<Whole_Number::Word>(value)));
+            };
+
+            Integer acc;
+            Integer next_den;
+
+            std::vector<Integer> suffix(m);
+
+            for (Size j = blocks; j-- > 0; ) {
+
+                Size first = j * m;
+
+                // suffix[i] = q(first + i + 1) * ... * q(first + m - 1), and D_j = suffix[0].
+
+                suffix[m - 1] = ONE;
+
+                for (Size i = m - 1; i-- > 0; ) {
+                    suffix[i] = suffix[i + 1] * factor(q(first + i + 1));
+                }
+
+                Integer block;
+                Integer prefix = ONE;
+
+                for (Size i = 0; i < m; ++i) {
+
+                    if (i) {
+                        prefix *= factor(p(first + i));
+                    }
+
+                    block += powers[i]._number * (prefix * suffix[i]);
+                }
+
+                if (j + 1 < blocks) {
+
+                    prefix *= factor(p(first + m));
+
+                    Integer carry = powers[m]._number * acc * prefix;
+
+                    carry /= den * factor(q(first + m)) * next_den;
+
+                    block += carry;
+                }
+
+                acc      = std::move(block);
+                next_den = suffix[0];
+            }
+
+            Decimal sum;
+
+            sum._number = acc / next_den;
+            sum._scale  = scale;
+
+            return sum;
+        }
+
+        void Decimal::set_integer(Text& value) {
+            _number = Integer(value) * denominator();
+        }
+
+        void Decimal::set_decimal(Text& value) {
+
+            lrtrim(value);
+
+            if (!value.empty()) {
+
+                Integer exponent = get_sub_text_value(value, "e");
+
+                _scale  = find_and_set_scale(value);
+                _number = Integer(value);
+
+                set_decimal_exponent(exponent);
+
+                rescale(decimal_scale());
+            }
+        }
+
+        void Decimal::set_rational(Text& value) {
+
+            // Locate and set the denominator.
+            Integer den(get_sub_text_value(value, "/"));
+
+            if (!den.is()) {
+                _number = Integer::UNDEF;
+                return;
+            }
+
+            lrtrim(value);
+
+            // Look if a leading integer is present and get it.
+            Text lead_val_str = "";
+
+            auto found = value.find_last_of(' ');
+
+            if (found != std::string::npos) {
+
+                lead_val_str = value.substr(0, found);
+
+                value.erase(0, found);
+            }
+
+            // Define the leading integer.
+            Integer lead_value(lead_val_str);
+
+            _number = Integer(value);
+
+            // Add any leading value to the number.
+            if (lead_value.is()) {
+
+                _number = _number + (lead_value * den);
+            }
+
+            _number = divide(_number * denominator(), den, round_mode());
+        }
+
+        void Decimal::set_whole(Text& value) {
+            _number = Integer(value, 10);
+        }
+
+        void Decimal::set_binary(Text& value) {
+            _number = Integer(value, 2);
+        }
+
+        void Decimal::set_octal(Text& value) {
+            _number = Integer(value, 8);
+        }
+
+        void Decimal::set_heximal(Text& value) {
+            _number = Integer(value, 16);
+        }
+
+        void Decimal::set_decimal_exponent(Integer& exponent) {
+            /*
+                Test if an exponent was defined then apply the exponent to the
+                _scale of the digits read, so no digit is lost before the number is
+                rescaled.  Only an exponent past that scale multiplies the number.
+            */
+            if (exponent.is()) {
+
+                Size exp = exponent.abs().to_integral<Size>();
+
+                if (exponent.is_negative()) {
+
+                    _scale += exp;
+                }
+                else if (exp <= _scale) {
+
+                    _scale -= exp;
+                }
+                else {
+
+                    _number *= Integer(Power_Cache::power(10, exp - _scale));
+                    _scale   = 0;
+                }
+            }
+        }
+
+        Integer Decimal::get_sub_text_value(Text& value, Text del) const {
+            /*
+                See if a value is defined for a specific deliminator.  If found get and
+                return the Ineger after the delimeter, preserving the remaingin text.
+            */
+            auto found = value.find(del);
+
+            Text sub_string_value = "";
+
+            Integer derived_value;
+
+            if (found != std::string::npos) {
+
+                if (value.begin() + found < value.end()) {
+                    sub_string_value = value.substr(found + 1);
+                }
+                value.erase(found);
+
+                derived_value = Integer(sub_string_value);
+            }
+
+            return derived_value;
+        }
+
+        Size Decimal::find_and_set_scale(Text& value) const {
+            /*
+                Find the decimal point which is required to for all
+                Decimal number text input.  Every digit is kept, so
+                the value can be rounded to the scale.
+            */
+
+            sys_int scale = 0;
+
+            auto found = value.find(".");
+
+            if (found != std::string::npos) {
+                value.at(found) = ' ';
+
+                scale = static_cast<sys_int>(value.size() - found) - 1;
+                if (scale < 1) {
+                    scale = 0;
+                }
+            }
+
+            return scale;
+        }
+    }
+}  // end Olly
@@ -1,228 +1,328 @@
-#pragma once
-
-/*********************************************************************/
-//
-//			Copyright 2022 Max J. Martin
-//
-//			This file is part of APM.
-// 
-//			APM is free software : you can redistribute it
-//			and /or modify it under the terms of the GNU General
-//			Public License as published by the Free Software
-//			Foundation, either version 3 of the License, or
-//			(at your option) any later version.
-//			
-//			APM is distributed in the hope that it will be
-//			useful, but WITHOUT ANY WARRANTY; without even the
-//			implied warranty of MERCHANTABILITY or FITNESS FOR
-//			A PARTICULAR PURPOSE.See the GNU General Public
-//			
-//			You should have received a copy of the GNU General
-//			Public License along with APM.If not, see
-//			< https://www.gnu.org/licenses/>.
-//			
-/*********************************************************************/
-
-#include "Integer.h"
-#include "numerical_strings.h"
-
-namespace Olly {
-    namespace APM {
-
-        /********************************************************************************************/
-        //
-        //                              'Decimal' Class Declaration
-        //
-        /********************************************************************************************/
-
-        class Decimal {
-
-            const enum class ROUNDING_MODE {
-                toward_zero = 0, half_up, half_down, half_even, half_odd, ceil, floor, away_from_zero
-            };
-
-        public:
-
-            static sys_int scale();
-            static void    scale(const sys_int& scale);
-
-            static Text rounding_mode();
-            static void rounding_mode(const Text& mode);
-
-            static Integer decimal_denominator();
-
-            static Decimal e();
-            static Decimal pi();
-            static Decimal ln2();
-
-            Decimal();
-            Decimal(Text value);
-            virtual ~Decimal();
-
-            Decimal(Decimal&& obj) = default;
-            Decimal(const Decimal& obj) = default;
-            Decimal& operator=(const Decimal& obj) = default;
-            Decimal& operator=(Decimal&& obj) = default;
-
-            Boolean is() const;
-
-            Boolean is_odd()      const;
-            Boolean is_even()     const;
-            Boolean is_positive() const;
-            Boolean is_negative() const;
-            Boolean is_zero()     const;
-            Boolean is_undefined() const;
-            Boolean is_defined()   const;
-            Boolean is_nan()       const;
-            Boolean is_finite()    const;
-            Boolean is_infinite()  const;
-
-            Boolean operator==(const Decimal& b) const;
-            Boolean operator!=(const Decimal& b) const;
-            Boolean operator< (const Decimal& b) const;
-            Boolean operator> (const Decimal& b) const;
-            Boolean operator<=(const Decimal& b) const;
-            Boolean operator>=(const Decimal& b) const;
-
-            sys_float compare(const Decimal& other) const;
-
-            Decimal operator+() const;
-            Decimal operator-() const;
-
-            Decimal& operator+=(const Decimal& b);
-            Decimal& operator-=(const Decimal& b);
-            Decimal& operator*=(const Decimal& b);
-            Decimal& operator/=(const Decimal& b);
-            Decimal& operator%=(const Decimal& b);
-
-            Decimal operator+(const Decimal& b) const;
-            Decimal operator-(const Decimal& b) const;
-            Decimal operator*(const Decimal& b) const;
-            Decimal operator/(const Decimal& b) const;
-            Decimal operator%(const Decimal& b) const;
-
-            void div_rem(const Decimal& b, Decimal& qot, Decimal& rem) const;
-
-            //decimal hypot(const decimal& b)                    const;
-            //decimal hypot(const decimal& b, const decimal& c) const;
-
-            //decimal    ln()                 const;
-            //decimal  log2()                 const;
-            //decimal log10()                 const;
-            //decimal   log(const decimal& b) const;
-
-            //decimal sin() const;
-            //decimal cos() const;
-            //decimal tan() const;
-
-            //decimal round(const decimal& scale) const;
-
-            Decimal abs()       const;
-            Decimal inverse()   const;
-            Decimal ceil()      const;
-            Decimal floor()     const;
-
-            Decimal gcd  (const Decimal& b)                   const;
-            Decimal pow  (const Decimal& b)                   const;
-            Decimal root (const Decimal& b)                   const;
-            Decimal hypot(const Decimal& b)                   const;
-            Decimal hypot(const Decimal& b, const Decimal& c) const;
-
-            Decimal    ln()                 const;
-            Decimal  log2()                 const;
-            Decimal log10()                 const;
-            Decimal   log(const Decimal& b) const;
-
-            Decimal sin() const;
-            Decimal cos() const;
-            Decimal tan() const;
-
-            Decimal asin() const;
-            Decimal acos() const;
-            Decimal atan() const;
-
-            Decimal sinh() const;
-            Decimal cosh() const;
-            Decimal tanh() const;
-
-            Decimal asinh() const;
-            Decimal acosh() const;
-            Decimal atanh() const;
-
-            Text sign()                             const;
-            Text to_string()                        const;
-            Text to_string(Size base, sys_int sign) const;
-
-            template<typename N>
-            N to_integral() const;
-
-            const Integer& get_Integer() const;
-
-        private:
-
-            static const Integer ONE;
-            static const Integer TWO;
-            static const Integer TEN;
-
-            static const Size DEF_VIEW  = 16;
-            static const Size DEF_SCALE = 32;
-            static const Size MIN_SCALE = 8;
-            static const Size MAX_SCALE = 10000;
-
-            static Boolean& scale_not_configured();
-            static Size& decimal_scale();
-            static Integer& denominator();
-
-            static Integer& integer_pi();
-            static Integer& integer_e();
-            static Integer& integer_ln2();
-
-            static Decimal& decimal_pi();
-            static Decimal& decimal_e();
-            static Decimal& decimal_ln2();
-            static Decimal& decimal_360();
-            static Decimal& decimal_180();
-            static Decimal& decimal_45();
-
-            static ROUNDING_MODE& round_mode();
-
-            Integer _number;
-
-            Decimal(sys_int value);
-            Decimal(const Integer& value);
-            Decimal(const Whole_Number& value);
-
-            Decimal get_ln()   const;
-            Decimal get_sin()  const;
-            Decimal get_asin() const;
-            Decimal get_atan() const;
-            Decimal get_sinh() const;
-            Decimal get_cosh() const;
-
-            void set_integer(Text& value);
-            void set_decimal(Text& value);
-            void set_rational(Text& value);
-            void set_whole(Text& value);
-            void set_binary(Text& value);
-            void set_octal(Text& value);
-            void set_heximal(Text& value);
-
-            void  set_decimal_exponent(Integer& exponent);
-            Integer get_sub_text_value(Text& value, Text del) const;
-            Size    find_and_set_scale(Text& value)           const;
-        };
-
-        template<typename N>
-        inline N Decimal::to_integral() const {
-
-            N a = (_number / denominator()).to_integral<N>();
-
-            if (std::is_signed<N>::value && is_negative()) {
-
-                a *= -1;
-            }
-
-            return a;
-        }
-    }
-}
+#pragma once
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+// 
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//			
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//			
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//			
+/*********************************************************************/
+
+#include "Integer.h"
+#include "Decimal_Context.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                              'Decimal' Class Declaration
+        //
+        /********************************************************************************************/
+
+        class Decimal {
+
+            typedef Decimal_Context::ROUNDING_MODE ROUNDING_MODE;
+            typedef Decimal_Context::CONSTANT      CONSTANT;
+
+        public:
+
+            static sys_int scale();
+            static void    scale(const sys_int& scale);
+
+            static Text rounding_mode();
+            static void rounding_mode(const Text& mode);
+
+            static Integer decimal_denominator();
+
+            static Decimal e();
+            static Decimal pi();
+            static Decimal ln2();
+
+            Decimal();
+            Decimal(Text value);
+            virtual ~Decimal();
+
+            Decimal(Decimal&& obj) = default;
+            Decimal(const Decimal& obj) = default;
+            Decimal& operator=(const Decimal& obj) = default;
+            Decimal& operator=(Decimal&& obj) = default;
+
+            Boolean is() const;
+
+            Boolean is_odd()      const;
+            Boolean is_even()     const;
+            Boolean is_positive() const;
+            Boolean is_negative() const;
+            Boolean is_zero()     const;
+            Boolean is_undefined() const;
+            Boolean is_defined()   const;
+            Boolean is_nan()       const;
+            Boolean is_finite()    const;
+            Boolean is_infinite()  const;
+
+            Boolean operator==(const Decimal& b) const;
+            Boolean operator!=(const Decimal& b) const;
+            Boolean operator< (const Decimal& b) const;
+            Boolean operator> (const Decimal& b) const;
+            Boolean operator<=(const Decimal& b) const;
+            Boolean operator>=(const Decimal& b) const;
+
+            sys_float compare(const Decimal& other) const;
+
+            Decimal operator+() const;
+            Decimal operator-() const;
+
+            Decimal& operator+=(const Decimal& b);
+            Decimal& operator-=(const Decimal& b);
+            Decimal& operator*=(const Decimal& b);
+            Decimal& operator/=(const Decimal& b);
+            Decimal& operator%=(const Decimal& b);
+
+            Decimal operator+(const Decimal& b) const;
+            Decimal operator-(const Decimal& b) const;
+            Decimal operator*(const Decimal& b) const;
+            Decimal operator/(const Decimal& b) const;
+            Decimal operator%(const Decimal& b) const;
+
+            void div_rem(const Decimal& b, Decimal& qot, Decimal& rem) const;
+
+            //decimal hypot(const decimal& b)                    const;
+            //decimal hypot(const decimal& b, const decimal& c) const;
+
+            //decimal    ln()                 const;
+            //decimal  log2()                 const;
+            //decimal log10()                 const;
+            //decimal   log(const decimal& b) const;
+
+            //decimal sin() const;
+            //decimal cos() const;
+            //decimal tan() const;
+
+            //decimal round(const decimal& scale) const;
+
+            Decimal abs()          const;
+            Decimal inverse()      const;
+            Decimal sqrt()         const;
+            Decimal inverse_sqrt() const;
+            Decimal ceil()         const;
+            Decimal floor()        const;
+
+            Decimal quantize(Size digits) const;    // Round to 'digits' places, in the rounding mode.
+
+            Decimal gcd  (const Decimal& b)                   const;
+            Decimal pow  (const Decimal& b)                   const;
+            Decimal root (const Decimal& b)                   const;
+            Decimal hypot(const Decimal& b)                   const;
+            Decimal hypot(const Decimal& b, const Decimal& c) const;
+
+            Decimal   exp()                 const;
+            Decimal    ln()                 const;
+            Decimal  log2()                 const;
+            Decimal log10()                 const;
+            Decimal   log(const Decimal& b) const;
+
+            Decimal sin() const;                                        // Of an angle in degrees.
+            Decimal cos() const;
+            Decimal tan() const;
+            void    sincos(Decimal& sin_x, Decimal& cos_x) const;
+
+            Decimal radian_sin() const;                                 // Of an angle in radians.
+            Decimal radian_cos() const;
+            Decimal radian_tan() const;
+            void    radian_sincos(Decimal& sin_x, Decimal& cos_x) const;
+
+            Decimal asin() const;
+            Decimal acos() const;
+            Decimal atan() const;
+
+            Decimal sinh() const;
+            Decimal cosh() const;
+            Decimal tanh() const;
+
+            Decimal asinh() const;
+            Decimal acosh() const;
+            Decimal atanh() const;
+
+            Text sign()                             const;
+            Text to_string()                        const;
+            Text to_string(Size base, sys_int sign) const;
+
+            void write_digits(std::ostream& out) const;    // The text of 'to_string', streamed.
+            void write_digits(FILE* file)        const;
+
+            static Decimal read_digits(std::istream& in);  // Digits with an optional sign and point.
+
+            template<typename N>
+            N to_integral() const;
+
+            const Integer& get_Integer() const;
+            Size           get_scale()   const;
+
+        private:
+
+            friend class Decimal_Batch;             // The span kernels of 'Batch.h'.
+            friend class Binary_Format;             // The encodings of 'Binary_Format.h'.
+            friend class Number_Literal;            // The literals of 'Literals.h'.
+
+            static const Integer ONE;
+            static const Integer TWO;
+            static const Integer TEN;
+
+            static const Size DEF_VIEW     = 16;
+            static const Size GUARD_DIGITS = Decimal_Context::GUARD_DIGITS;
+            static const Size AGM_SCALE    = 4000;  // The scale from which ln() uses the AGM.
+            static const Size DEF_SCALE    = Decimal_Context::DEF_SCALE;
+            static const Size MIN_SCALE    = Decimal_Context::MIN_SCALE;
+            static const Size MAX_SCALE    = Decimal_Context::MAX_SCALE;
+
+            static Decimal_Context& context();
+
+            static Size           decimal_scale();
+            static const Integer& denominator();
+            static Integer        denominator(Size scale);
+            static const Divisor& divisor();                // The denominator, prepared for division.
+
+            static const Integer& integer_pi();
+            static const Integer& integer_e();
+            static const Integer& integer_ln2();
+
+            static Decimal decimal_pi();
+            static Decimal decimal_e();
+            static Decimal decimal_ln2();
+            static Decimal decimal_360();
+            static Decimal decimal_180();
+            static Decimal decimal_45();
+
+            static ROUNDING_MODE round_mode();
+
+            Integer _number;
+            Size    _scale;      // The scale '_number' is held at.
+
+            Decimal(sys_int value);
+            Decimal(const Integer& value);
+            Decimal(const Whole_Number& value);
+
+            void write_digits(const Whole_Number::Digit_Sink& sink) const;
+
+            sys_float log10_abs() const;
+
+            Boolean align(const Decimal& b);
+            Decimal rescaled() const;
+            void    rescale(Size scale);
+
+            template<typename F>
+            static Decimal correctly_rounded(F evaluate);
+            template<typename F>
+            static void    correctly_rounded(Decimal& a, Decimal& b, F evaluate);
+
+            Decimal        nth_root(Size k, Boolean reciprocal) const;                          // |a|^(1/k), or its reciprocal.
+            static Decimal newton_root(const Decimal& m, Size k, Size scale, sys_float start);
+
+            static Integer divide(const Integer& n, const Integer& d, ROUNDING_MODE mode);
+            static Integer divide(const Integer& n, const Divisor& d, ROUNDING_MODE mode);     // By a positive d.
+            static Integer round_quotient(Integer q, const Integer& r, const Whole_Number& d, Boolean positive, ROUNDING_MODE mode);
+            static Boolean round_settled(Decimal& a, Decimal& b, Size scale, Size guard, Boolean last);
+
+            Decimal eval_exp()                       const;
+            Decimal eval_ln()                        const;
+            Decimal eval_pow(const Decimal& b)       const;
+            Decimal eval_whole_pow(Size m, Boolean reciprocal) const;
+            void    eval_sincos(Decimal& sin_x, Decimal& cos_x)        const;
+            void    eval_radian_sincos(Decimal& sin_x, Decimal& cos_x) const;
+            Decimal eval_asin()                      const;
+            Decimal eval_atan()                      const;
+            Decimal eval_sinh()                      const;
+            Decimal eval_cosh()                      const;
+            Decimal eval_tanh()                      const;
+
+            Decimal get_exp()    const;
+            Decimal get_ln()     const;
+            Decimal get_agm_ln() const;
+            void    get_sincos(Decimal& sin_x, Decimal& cos_x) const;
+            Decimal get_asin()   const;
+            Decimal get_atan()   const;
+
+            typedef Size (*Series_Factor)(Size k);
+
+            static Size                 series_terms (const Decimal& x, Series_Factor p, Series_Factor q);
+            static std::vector<Decimal> series_powers(const Decimal& x, Size terms);
+            static Decimal              sum_series   (const std::vector<Decimal>& powers, Size terms,
+                                                      Series_Factor p, Series_Factor q);
+
+            void set_integer(Text& value);
+            void set_decimal(Text& value);
+            void set_rational(Text& value);
+            void set_whole(Text& value);
+            void set_binary(Text& value);
+            void set_octal(Text& value);
+            void set_heximal(Text& value);
+
+            void  set_decimal_exponent(Integer& exponent);
+            Integer get_sub_text_value(Text& value, Text del) const;
+            Size    find_and_set_scale(Text& value)           const;
+        };
+
+        template<typename F>
+        inline Decimal Decimal::correctly_rounded(F evaluate) {
+
+            Decimal a, b;
+
+            correctly_rounded(a, b, [&evaluate](Decimal& x, Decimal&) { x = evaluate(); });
+
+            return a;
+        }
+
+        template<typename F>
+        inline void Decimal::correctly_rounded(Decimal& a, Decimal& b, F evaluate) {
+            /*
+                Ziv's strategy.  Evaluate with guard digits, and keep the result once it
+                rounds the same way across its error bound.  Else retry with twice the
+                guard digits.  A retry that lands on a rounding boundary is exact, see
+                round_settled, and the guard digits stop growing once they pass the scale.
+            */
+
+            const Size scale = decimal_scale();
+
+            for (Size guard = GUARD_DIGITS; ; guard *= 2) {
+                {
+                    Decimal_Context_Guard context(scale + guard);
+
+                    evaluate(a, b);
+                }
+
+                if (round_settled(a, b, scale, guard, guard > scale + GUARD_DIGITS)) {
+                    return;
+                }
+            }
+        }
+
+        template<typename N>
+        inline N Decimal::to_integral() const {
+
+            N a = (_number / denominator(_scale)).to_integral<N>();
+
+            if (std::is_signed<N>::value && is_negative()) {
+
+                a *= -1;
+            }
+
+            return a;
+        }
+    }
+}
@@ -0,0 +1,213 @@
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include <algorithm>
+#include <vector>
+#include "Decimal_Context.h"
+#include "Power_Cache.h"
+
+namespace Olly {
+    namespace APM {
+
+        static const Size RECENT_SCALES = 4;    // The scales whose denominators each thread keeps.
+
+        struct Recent_Scale {
+
+            Size    scale = 0;
+            Integer denominator;
+            Divisor divisor;        // Built on first use.
+        };
+
+        static Recent_Scale& recent_scale(Size scale) {
+            /*
+                The thread's entry for the scale, moved to the front of its recent scales.
+                A scale not among them takes the place of the least recent one.
+            */
+            static thread_local std::vector<Recent_Scale> recent(RECENT_SCALES);
+
+            auto found = recent.begin();
+
+            while (found != recent.end() - 1 && found->scale != scale) {
+                ++found;
+            }
+
+            std::rotate(recent.begin(), found, found + 1);
+
+            Recent_Scale& entry = recent.front();
+
+            if (entry.scale != scale) {
+                entry.scale       = scale;
+                entry.denominator = Integer(Power_Cache::power(10, scale));
+                entry.divisor     = Divisor();
+            }
+
+            return entry;
+        }
+
+        Decimal_Context& Decimal_Context::current() {
+
+            static thread_local Decimal_Context context;
+
+            return context;
+        }
+
+        Decimal_Context::Decimal_Context() : Decimal_Context(DEF_SCALE) {
+        }
+
+        Decimal_Context::Decimal_Context(Size scale, ROUNDING_MODE mode)
+            : _scale(0), _precision(DEF_SCALE), _mode(mode), _denominator(1), _divisor(), _constants() {
+
+            this->scale(scale);
+        }
+
+        Decimal_Context::~Decimal_Context() {
+        }
+
+        Size Decimal_Context::scale() const {
+            return _scale;
+        }
+
+        void Decimal_Context::scale(Size scale) {
+
+            scale = (scale >= MIN_SCALE) ? scale : MIN_SCALE;
+            scale = (scale <= MAX_SCALE) ? scale : MAX_SCALE;
+
+            if (scale != _scale) {
+
+                Recent_Scale& entry = recent_scale(scale);
+
+                _scale       = scale;
+                _denominator = entry.denominator;
+                _divisor     = entry.divisor;
+            }
+        }
+
+        Size Decimal_Context::precision() const {
+            return _precision;
+        }
+
+        void Decimal_Context::precision(Size digits) {
+            _precision = digits;
+        }
+
+        Decimal_Context::ROUNDING_MODE Decimal_Context::rounding() const {
+            return _mode;
+        }
+
+        void Decimal_Context::rounding(ROUNDING_MODE mode) {
+            _mode = mode;
+        }
+
+        const Integer& Decimal_Context::denominator() const {
+            return _denominator;
+        }
+
+        const Divisor& Decimal_Context::divisor() {
+
+            if (!_divisor.is()) {
+
+                Recent_Scale& entry = recent_scale(_scale);
+
+                if (!entry.divisor.is()) {
+                    entry.divisor = Divisor(_denominator.get_Whole_Number());
+                }
+
+                _divisor = entry.divisor;
+            }
+
+            return _divisor;
+        }
+
+        Boolean Decimal_Context::find_constant(CONSTANT c) {
+
+            Constant& held = _constants[static_cast<Size>(c)];
+
+            if (held.scale == _scale && held.value.is()) {
+                return true;
+            }
+
+            if (held.finest_scale < _scale || !held.finest.is()) {
+                return false;
+            }
+
+            // Truncate the finest value to the scale.
+            held.scale = _scale;
+            held.value = held.finest / Integer(Power_Cache::power(10, held.finest_scale - _scale));
+
+            return true;
+        }
+
+        const Integer& Decimal_Context::constant(CONSTANT c) const {
+            return _constants[static_cast<Size>(c)].value;
+        }
+
+        void Decimal_Context::constant(CONSTANT c, const Integer& value) {
+
+            Constant& held = _constants[static_cast<Size>(c)];
+
+            if (_scale > held.finest_scale || !held.finest.is()) {
+                held.finest_scale = _scale;
+                held.finest       = value;
+            }
+
+            held.scale = _scale;
+            held.value = value;
+        }
+
+        Decimal_Context_Guard::Decimal_Context_Guard(const Decimal_Context& context) : _saved() {
+
+            Decimal_Context& current = Decimal_Context::current();
+
+            auto constants = std::move(current._constants);
+
+            _saved = std::move(current);
+
+            current = context;
+
+            current._constants = std::move(constants);
+        }
+
+        Decimal_Context_Guard::Decimal_Context_Guard(Size scale) : _saved() {
+
+            Decimal_Context& current = Decimal_Context::current();
+
+            auto constants = std::move(current._constants);
+
+            _saved = current;
+
+            current._constants = std::move(constants);
+
+            current.scale(scale);
+        }
+
+        Decimal_Context_Guard::~Decimal_Context_Guard() {
+
+            Decimal_Context& current = Decimal_Context::current();
+
+            _saved._constants = std::move(current._constants);
+
+            current = std::move(_saved);
+        }
+    }
+}
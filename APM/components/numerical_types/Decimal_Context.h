@@ -0,0 +1,143 @@
+#pragma once
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include <array>
+#include "Divisor.h"
+#include "Integer.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                              'Decimal_Context' Class Declaration
+        //
+        //        The precision and rounding state of the decimal types.  Every thread owns a
+        //        current context, so threads never share the cached denominator or constants.
+        //        Use a 'Decimal_Context_Guard' to swap in a different context for a scope.
+        //
+        //        Each thread also keeps the denominators and divisors of its few most
+        //        recent scales, so a guard that steps out to a wider scale and back
+        //        finds both again without the shared 'Power_Cache' or a new reciprocal.
+        //
+        /********************************************************************************************/
+
+        class Decimal_Context {
+
+        public:
+
+            enum class ROUNDING_MODE {
+                toward_zero = 0, half_up, half_down, half_even, half_odd, ceil, floor, away_from_zero
+            };
+
+            enum class CONSTANT {
+                pi = 0, e, ln2, count
+            };
+
+            static const Size DEF_SCALE = 32;
+            static const Size MIN_SCALE = 8;
+            static const Size MAX_SCALE = 1000000000;
+
+            static const Size GUARD_DIGITS = 10;    // Extra digits carried by a function evaluation.
+
+            static Decimal_Context& current();                  // The context of the calling thread.
+
+            Decimal_Context();
+            Decimal_Context(Size scale, ROUNDING_MODE mode = ROUNDING_MODE::half_even);
+            virtual ~Decimal_Context();
+
+            Decimal_Context(Decimal_Context&& obj)                 = default;
+            Decimal_Context(const Decimal_Context& obj)            = default;
+            Decimal_Context& operator=(const Decimal_Context& obj) = default;
+            Decimal_Context& operator=(Decimal_Context&& obj)      = default;
+
+            Size scale() const;                                 // Digits held after the decimal point.
+            void scale(Size scale);
+
+            Size precision() const;                             // Significant digits of a Big_Float.
+            void precision(Size digits);
+
+            ROUNDING_MODE rounding() const;
+            void          rounding(ROUNDING_MODE mode);
+
+            const Integer& denominator() const;                 // 10^scale.
+            const Divisor& divisor();                           // The denominator, prepared for division
+                                                                // on first use at the scale.
+
+            Boolean        find_constant(CONSTANT c);           // Look for a constant held at the scale, deriving
+                                                                // it from the finest one held if possible.
+            const Integer& constant(CONSTANT c) const;          // A constant scaled by the denominator.
+            void           constant(CONSTANT c, const Integer& value);
+
+        private:
+
+            friend class Decimal_Context_Guard;
+
+            static const Size CONSTANTS = static_cast<Size>(CONSTANT::count);
+
+            Size          _scale;
+            Size          _precision;
+            ROUNDING_MODE _mode;
+            Integer       _denominator;
+            Divisor       _divisor;
+
+            struct Constant {
+
+                Size    finest_scale = 0;   // The finest value computed,
+                Integer finest;
+                Size    scale        = 0;   // and that value truncated to the last scale asked for.
+                Integer value;
+            };
+
+            std::array<Constant, CONSTANTS> _constants;
+        };
+
+        /********************************************************************************************/
+        //
+        //                           'Decimal_Context_Guard' Class Declaration
+        //
+        //        Installs a context as the current context of the thread, and restores the
+        //        prior context when the guard leaves scope.  The cached constants stay with the
+        //        thread, so a constant derived at a finer scale inside the guard is kept.
+        //
+        /********************************************************************************************/
+
+        class Decimal_Context_Guard {
+
+        public:
+
+            Decimal_Context_Guard(const Decimal_Context& context);
+            Decimal_Context_Guard(Size scale);
+            virtual ~Decimal_Context_Guard();
+
+            Decimal_Context_Guard(const Decimal_Context_Guard& obj)            = delete;
+            Decimal_Context_Guard& operator=(const Decimal_Context_Guard& obj) = delete;
+
+        private:
+
+            Decimal_Context _saved;
+        };
+    }
+}
@@ -1,236 +1,398 @@
-
-/*********************************************************************/
-//
-//			Copyright 2022 Max J. Martin
-//
-//			This file is part of APM.
-// 
-//			APM is free software : you can redistribute it
-//			and /or modify it under the terms of the GNU General
-//			Public License as published by the Free Software
-//			Foundation, either version 3 of the License, or
-//			(at your option) any later version.
-//			
-//			APM is distributed in the hope that it will be
-//			useful, but WITHOUT ANY WARRANTY; without even the
-//			implied warranty of MERCHANTABILITY or FITNESS FOR
-//			A PARTICULAR PURPOSE.See the GNU General Public
-//			
-//			You should have received a copy of the GNU General
-//			Public License along with APM.If not, see
-//			< https://www.gnu.org/licenses/>.
-//			
-/*********************************************************************/
-
-#include "Decimal.h"
-
-namespace Olly {
-    namespace APM {
-
-        const Integer Decimal::ONE = Integer(1);
-        const Integer Decimal::TWO = Integer(2);
-        const Integer Decimal::TEN = Integer(10);
-
-        sys_int Decimal::scale() {
-            return decimal_scale();
-        }
-
-        void Decimal::scale(const sys_int& scale) {
-
-            sys_int scl = (scale >= MIN_SCALE) ? scale : MIN_SCALE;
-                    scl = (scl <= MAX_SCALE) ? scl : MAX_SCALE;
-
-            if (scale_not_configured()) {
-
-                scale_not_configured() = false;
-                decimal_scale()        = scl;
-                denominator()          = Decimal::TEN.pow(scl);
-
-                integer_e();
-                integer_pi();
-                integer_ln2();
-
-                decimal_360();
-                decimal_180();
-                decimal_45();
-            }
-        }
-
-        Text Decimal::rounding_mode() {
-
-            switch (round_mode()) {
-
-            case(ROUNDING_MODE::half_up):
-                return "half_up";
-
-            case(ROUNDING_MODE::half_down):
-                return "half_down";
-
-            case(ROUNDING_MODE::half_even):
-                return "half_even";
-
-            case(ROUNDING_MODE::half_odd):
-                return "half_odd";
-
-            case(ROUNDING_MODE::ceil):
-                return "ceil";
-
-            case(ROUNDING_MODE::floor):
-                return "floor";
-
-            case(ROUNDING_MODE::away_from_zero):
-                return "away_from_zero";
-            }
-
-            return "toward_zero";
-        }
-
-        void Decimal::rounding_mode(const Text& mode) {
-
-            if (mode == "half_up") {
-                round_mode() = ROUNDING_MODE::half_up;
-            }
-
-            else if (mode == "half_down") {
-                round_mode() = ROUNDING_MODE::half_down;
-            }
-
-            else if (mode == "half_even") {
-                round_mode() = ROUNDING_MODE::half_even;
-            }
-
-            else if (mode == "half_odd") {
-                round_mode() = ROUNDING_MODE::half_odd;
-            }
-
-            else if (mode == "ceil") {
-                round_mode() = ROUNDING_MODE::ceil;
-            }
-
-            else if (mode == "floor") {
-                round_mode() = ROUNDING_MODE::floor;
-            }
-
-            else if (mode == "away_from_zero") {
-                round_mode() = ROUNDING_MODE::away_from_zero;
-            }
-
-            else {
-                ROUNDING_MODE::toward_zero;
-            }
-        }
-
-        Integer Decimal::decimal_denominator() {
-            return denominator();
-        }
-
-        Decimal Decimal::e() {
-            return decimal_e();
-        }
-
-        Decimal Decimal::pi() {
-            return decimal_pi();
-        }
-
-        Decimal Decimal::ln2() {
-            return decimal_ln2();
-        }
-
-        Boolean& Decimal::scale_not_configured() {
-
-            static Boolean truth = true;
-
-            return truth;
-        }
-
-        Size& Decimal::decimal_scale() {
-
-            static Size scale = DEF_SCALE;
-
-            return scale;
-        }
-
-        Integer& Decimal::denominator() {
-
-            static Integer denom = Decimal::TEN;
-
-            return denom;
-        }
-
-        Integer& Decimal::integer_pi() {
-
-            static Integer pi(PI_STRING.substr(0, decimal_scale() + 1));
-
-            return pi;
-        }
-
-        Integer& Decimal::integer_e() {
-
-            static Integer e(E_STRING.substr(0, decimal_scale() + 1));
-
-            return e;
-        }
-
-        Integer& Decimal::integer_ln2() {
-
-            static Integer ln2(LN2_STRING.substr(0, decimal_scale()));
-
-            return ln2;
-        }
-
-        Decimal& Decimal::decimal_e() {
-
-            static Decimal e;
-
-            e._number = integer_e();
-
-            return e;
-        }
-
-        Decimal& Decimal::decimal_pi() {
-
-            static Decimal pi;
-
-            pi._number = integer_pi();
-
-            return pi;
-        }
-
-        Decimal& Decimal::decimal_ln2() {
-
-            static Decimal ln2;
-
-            ln2._number = integer_ln2();
-
-            return ln2;
-        }
-
-        Decimal& Decimal::decimal_360() {
-            
-            static Decimal d(360);
-
-            return d;
-        }
-
-        Decimal& Decimal::decimal_180() {
-            
-            static Decimal d(180);
-
-            return d;
-        }
-
-        Decimal& Decimal::decimal_45() {
-            
-            static Decimal d(45);
-
-            return d;
-        }
-
-        Decimal::ROUNDING_MODE& Decimal::round_mode() {
-
-            ROUNDING_MODE mode = ROUNDING_MODE::half_even;
-
-            return mode;
-        }
-    }
-}
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+// 
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//			
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//			
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//			
+/*********************************************************************/
+
+#include <cmath>
+#include "Decimal.h"
+#include "Power_Cache.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                              Binary Splitting Evaluators
+        //
+        //        Each constant is summed as a single exact fraction, splitting the range of
+        //        terms in half so the big multiplications happen between numbers of equal
+        //        size.  The result is the constant scaled by 10^digits, computed with guard
+        //        digits and then truncated.
+        //
+        /********************************************************************************************/
+
+        static void chudnovsky_split(Size a, Size b, const Integer& c3_24, Integer& P, Integer& Q, Integer& T) {
+
+            if (b - a == 1) {
+
+                if (a == 0) {
+                    P = Integer(1);
+                    Q = Integer(1);
+                }
+                else {
+                    sys_int k = static_cast<sys_int>(a);
+
+                    P  = Integer(6 * k - 5);
+                    P *= 2 * k - 1;
+                    P *= 6 * k - 1;
+
+                    Q = Integer(k).pow(3) * c3_24;
+                }
+
+                T  = Integer(545140134);
+                T *= static_cast<sys_int>(a);
+                T += 13591409;
+                T *= P;
+
+                if (a & 1) {
+                    T = -T;
+                }
+
+                return;
+            }
+
+            Size m = (a + b) / 2;
+
+            Integer P1, Q1, T1, P2, Q2, T2;
+
+            chudnovsky_split(a, m, c3_24, P1, Q1, T1);
+            chudnovsky_split(m, b, c3_24, P2, Q2, T2);
+
+            P = P1 * P2;
+            Q = Q1 * Q2;
+            T = Q2 * T1 + P1 * T2;
+        }
+
+        static void factorial_split(Size a, Size b, Integer& P, Integer& Q) {
+            /*
+                P / Q = 1/(a+1) + 1/((a+1)(a+2)) + ... + 1/((a+1)...b).
+            */
+            if (b - a == 1) {
+                P = Integer(1);
+                Q = Integer(static_cast<sys_int>(b));
+                return;
+            }
+
+            Size m = (a + b) / 2;
+
+            Integer P1, Q1, P2, Q2;
+
+            factorial_split(a, m, P1, Q1);
+            factorial_split(m, b, P2, Q2);
+
+            P = P1 * Q2 + P2;
+            Q = Q1 * Q2;
+        }
+
+        static void acoth_split(Size a, Size b, const Integer& x2, Integer& Q, Integer& B, Integer& T) {
+            /*
+                T / (B Q) = the sum over k in [a, b) of 1 / ((2k + 1) x^(2(k - a) + 2)),
+                save that the k = 0 term carries no power of x.
+            */
+            if (b - a == 1) {
+                Q = a == 0 ? Integer(1) : x2;
+                B = Integer(static_cast<sys_int>(2 * a + 1));
+                T = Integer(1);
+                return;
+            }
+
+            Size m = (a + b) / 2;
+
+            Integer Q1, B1, T1, Q2, B2, T2;
+
+            acoth_split(a, m, x2, Q1, B1, T1);
+            acoth_split(m, b, x2, Q2, B2, T2);
+
+            Q = Q1 * Q2;
+            B = B1 * B2;
+            T = B2 * Q2 * T1 + B1 * T2;
+        }
+
+        static Integer acoth(sys_int x, Size digits, const Integer& scale) {
+            /*
+                acoth(x) = 1/x + 1/(3x^3) + 1/(5x^5) + ..., scaled by 'scale' = 10^digits.
+            */
+            Size terms = static_cast<Size>(digits / (2.0 * std::log10(static_cast<sys_float>(x)))) + 2;
+
+            Integer Q, B, T;
+            acoth_split(0, terms, Integer(x) * Integer(x), Q, B, T);
+
+            Integer d = B * Q;
+
+            d *= x;
+
+            return (T * scale) / d;
+        }
+
+        static Integer chudnovsky_pi(Size digits) {
+
+            const Integer TEN(10);
+
+            Size    work  = digits + Decimal_Context::GUARD_DIGITS;
+            Size    terms = work / 14 + 2;
+            Integer c3_24 = Integer(640320).pow(3) / Integer(24);
+
+            Integer P, Q, T;
+            chudnovsky_split(0, terms, c3_24, P, Q, T);
+
+            // pi = 426880 sqrt(10005) Q / T
+            Integer root = (Integer(10005) * TEN.pow(2 * work)).sqrt();
+
+            Integer pi = (Integer(426880) * root * Q) / T;
+
+            return pi / TEN.pow(Decimal_Context::GUARD_DIGITS);
+        }
+
+        static Integer factorial_series_e(Size digits) {
+
+            const Integer TEN(10);
+
+            Size work = digits + Decimal_Context::GUARD_DIGITS;
+
+            // Sum until the last term, 1/n!, falls below the working precision.
+            Size      terms = 1;
+            sys_float log_f = 0;
+
+            while (log_f < static_cast<sys_float>(work)) {
+                terms += 1;
+                log_f += std::log10(static_cast<sys_float>(terms));
+            }
+
+            Integer P, Q;
+            factorial_split(0, terms, P, Q);
+
+            Integer scale = TEN.pow(work);
+
+            Integer e = scale + (P * scale) / Q;
+
+            return e / TEN.pow(Decimal_Context::GUARD_DIGITS);
+        }
+
+        static Integer machin_ln2(Size digits) {
+            /*
+                ln(2) = 18 acoth(26) - 2 acoth(4801) + 8 acoth(8749).
+            */
+            const Integer TEN(10);
+
+            Size    work  = digits + Decimal_Context::GUARD_DIGITS;
+            Integer scale = TEN.pow(work);
+
+            Integer ln2 = Integer(18) * acoth(26, work, scale) - Integer(2) * acoth(4801, work, scale) + Integer(8) * acoth(8749, work, scale);
+
+            return ln2 / TEN.pow(Decimal_Context::GUARD_DIGITS);
+        }
+
+        const Integer Decimal::ONE = Integer(1);
+        const Integer Decimal::TWO = Integer(2);
+        const Integer Decimal::TEN = Integer(10);
+
+        sys_int Decimal::scale() {
+            return decimal_scale();
+        }
+
+        void Decimal::scale(const sys_int& scale) {
+
+            sys_int scl = (scale >= static_cast<sys_int>(MIN_SCALE)) ? scale : MIN_SCALE;
+
+            context().scale(static_cast<Size>(scl));
+        }
+
+        Text Decimal::rounding_mode() {
+
+            switch (round_mode()) {
+
+            case(ROUNDING_MODE::half_up):
+                return "half_up";
+
+            case(ROUNDING_MODE::half_down):
+                return "half_down";
+
+            case(ROUNDING_MODE::half_even):
+                return "half_even";
+
+            case(ROUNDING_MODE::half_odd):
+                return "half_odd";
+
+            case(ROUNDING_MODE::ceil):
+                return "ceil";
+
+            case(ROUNDING_MODE::floor):
+                return "floor";
+
+            case(ROUNDING_MODE::away_from_zero):
+                return "away_from_zero";
+
+            default:
+                break;
+            }
+
+            return "toward_zero";
+        }
+
+        void Decimal::rounding_mode(const Text& mode) {
+
+            ROUNDING_MODE m = ROUNDING_MODE::toward_zero;
+
+            if (mode == "half_up") {
+                m = ROUNDING_MODE::half_up;
+            }
+
+            else if (mode == "half_down") {
+                m = ROUNDING_MODE::half_down;
+            }
+
+            else if (mode == "half_even") {
+                m = ROUNDING_MODE::half_even;
+            }
+
+            else if (mode == "half_odd") {
+                m = ROUNDING_MODE::half_odd;
+            }
+
+            else if (mode == "ceil") {
+                m = ROUNDING_MODE::ceil;
+            }
+
+            else if (mode == "floor") {
+                m = ROUNDING_MODE::floor;
+            }
+
+            else if (mode == "away_from_zero") {
+                m = ROUNDING_MODE::away_from_zero;
+            }
+
+            context().rounding(m);
+        }
+
+        Integer Decimal::decimal_denominator() {
+            return denominator();
+        }
+
+        Decimal Decimal::e() {
+            return decimal_e();
+        }
+
+        Decimal Decimal::pi() {
+            return decimal_pi();
+        }
+
+        Decimal Decimal::ln2() {
+            return decimal_ln2();
+        }
+
+        Decimal_Context& Decimal::context() {
+            return Decimal_Context::current();
+        }
+
+        Size Decimal::decimal_scale() {
+            return context().scale();
+        }
+
+        const Integer& Decimal::denominator() {
+            return context().denominator();
+        }
+
+        Integer Decimal::denominator(Size scale) {
+            return scale == decimal_scale() ? denominator() : Integer(Power_Cache::power(10, scale));
+        }
+
+        const Divisor& Decimal::divisor() {
+            return context().divisor();
+        }
+
+        const Integer& Decimal::integer_pi() {
+
+            Decimal_Context& ctx = context();
+
+            if (!ctx.find_constant(CONSTANT::pi)) {
+                ctx.constant(CONSTANT::pi, chudnovsky_pi(ctx.scale()));
+            }
+
+            return ctx.constant(CONSTANT::pi);
+        }
+
+        const Integer& Decimal::integer_e() {
+
+            Decimal_Context& ctx = context();
+
+            if (!ctx.find_constant(CONSTANT::e)) {
+                ctx.constant(CONSTANT::e, factorial_series_e(ctx.scale()));
+            }
+
+            return ctx.constant(CONSTANT::e);
+        }
+
+        const Integer& Decimal::integer_ln2() {
+
+            Decimal_Context& ctx = context();
+
+            if (!ctx.find_constant(CONSTANT::ln2)) {
+                ctx.constant(CONSTANT::ln2, machin_ln2(ctx.scale()));
+            }
+
+            return ctx.constant(CONSTANT::ln2);
+        }
+
+        Decimal Decimal::decimal_e() {
+
+            Decimal e;
+
+            e._number = integer_e();
+
+            return e;
+        }
+
+        Decimal Decimal::decimal_pi() {
+
+            Decimal pi;
+
+            pi._number = integer_pi();
+
+            return pi;
+        }
+
+        Decimal Decimal::decimal_ln2() {
+
+            Decimal ln2;
+
+            ln2._number = integer_ln2();
+
+            return ln2;
+        }
+
+        Decimal Decimal::decimal_360() {
+            return Decimal(360);
+        }
+
+        Decimal Decimal::decimal_180() {
+            return Decimal(180);
+        }
+
+        Decimal Decimal::decimal_45() {
+            return Decimal(45);
+        }
+
+        Decimal::ROUNDING_MODE Decimal::round_mode() {
+            return context().rounding();
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,227 @@
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+
+#include <algorithm>
+#include "Divisor.h"
+
+namespace Olly {
+    namespace APM {
+
+        Divisor::Divisor() : _d(), _limbs(0), _shift(0), _inverse(0), _reciprocal() {
+        }
+
+        Divisor::Divisor(const Whole_Number& d) : _d(d), _limbs(0), _shift(0), _inverse(0), _reciprocal() {
+
+            if (!_d.is()) {
+                return;
+            }
+
+            _limbs = _d.size_limbs();
+
+            if (_limbs == 1) {
+
+                Word w = _d._reg.at_reg(0);
+
+                _shift   = lead_zeros(w);
+                _inverse = reciprocal_word(static_cast<Word>(w << _shift));
+            }
+            else if (_limbs >= BARRETT_LIMBS) {
+
+                Whole_Number r;
+
+                (Whole_Number(1) << (2 * _limbs * Limb_Traits<Word>::BITS)).div_rem(_d, _reciprocal, r);
+
+                if (_reciprocal.size_limbs() > _limbs + 1) {
+                    _reciprocal = Whole_Number();       // Only d = B^(k - 1) has so long a reciprocal.
+                }
+            }
+        }
+
+        Divisor::~Divisor() {
+        }
+
+        Boolean Divisor::is() const {
+            return _limbs > 0;
+        }
+
+        const Whole_Number& Divisor::get_Whole_Number() const {
+            return _d;
+        }
+
+        void Divisor::div_rem(const Whole_Number& n, Whole_Number& qot, Whole_Number& rem) const {
+
+            if (_limbs == 0 || (_limbs > 1 && !_reciprocal.is())) {
+                return n.div_rem(_d, qot, rem);
+            }
+
+            APM_COUNT(div);
+
+            if (n < _d) {
+                rem = n;
+                qot = Whole_Number();
+                return;
+            }
+
+            if (_limbs == 1) {
+
+                Size size = n.size_limbs();
+
+                // Build into a local, since 'qot' or 'rem' may alias 'n'.
+                Whole_Number::Reg q(size, 0);
+
+                Word r = divrem_1_preinv(q.data(), n._reg.data(), size, static_cast<Word>(_d._reg.at_reg(0) << _shift), _shift, _inverse);
+
+                qot._reg = std::move(q.trim());
+                rem._reg = Whole_Number::Reg(1, r);
+
+                return;
+            }
+
+            /*
+                Divide the top 2k limbs, then bring down k limbs at a time below the
+                remainder, which is less than d, so each step divides less than B^2k.
+            */
+
+            const Size bits = Limb_Traits<Word>::BITS;
+
+            Size size = n.size_limbs();
+            Size pos  = size > 2 * _limbs ? size - 2 * _limbs : 0;
+
+            Whole_Number q, r;
+
+            barrett(n.limbs(pos, size), q, r);
+
+            while (pos > 0) {
+
+                Size take = std::min(_limbs, pos);
+
+                pos -= take;
+
+                Whole_Number x = (r << (take * bits)) + n.limbs(pos, pos + take);
+                Whole_Number y;
+
+                barrett(x, y, r);
+
+                q <<= take * bits;
+                q  += y;
+            }
+
+            qot = std::move(q);
+            rem = std::move(r);
+        }
+
+        void Divisor::barrett(const Whole_Number& n, Whole_Number& qot, Whole_Number& rem) const {
+            /*
+                Only the top k + 1 words of the estimate are kept, from a high product at
+                most one short.  The remainder is less than 4d < B^(k + 1), so only the low
+                k + 1 words of q * d are needed.  Either product is taken in full when one
+                of its operands is short, as the full product then costs the less.
+            */
+
+            const Size k    = _limbs;
+            const Size w    = k + 1;
+            const Size size = n.size_limbs();
+
+            const Word* a = n._reg.data();
+
+            Limb_Vector<Word> t(8 * w + 2, 0);
+
+            Word* x  = t.data();            // n >> (k - 1) words.
+            Word* m  = x  + w;              // The reciprocal.
+            Word* d  = m  + w;              // The divisor.
+            Word* hi = d  + w;              // The high product, of w + 2 words.
+            Word* lo = hi + w + 2;          // The low product, of up to 2w words.
+            Word* r  = lo + 2 * w;          // The low words of n, then the remainder.
+
+            for (Size i = k - 1; i < size; i += 1) {
+                x[i - (k - 1)] = a[i];
+            }
+
+            for (Size i = 0; i < std::min(size, w); i += 1) {
+                r[i] = a[i];
+            }
+
+            const Word* rp = _reciprocal._reg.data();
+            const Word* dp = _d._reg.data();
+
+            for (Size i = 0, end = _reciprocal.size_limbs(); i < end; i += 1) {
+                m[i] = rp[i];
+            }
+
+            for (Size i = 0; i < k; i += 1) {
+                d[i] = dp[i];
+            }
+
+            Size xs = size > k - 1 ? size - (k - 1) : 1;
+
+            if (4 * xs >= 3 * w) {
+                mulhigh_n(hi, x, m, w);
+            }
+            else {
+
+                Limb_Vector<Word> p(w + xs);
+
+                mul(p.data(), m, w, x, xs);
+
+                for (Size i = 0; i < xs; i += 1) {
+                    hi[2 + i] = p[w + i];
+                }
+            }
+
+            Word* q = hi + 2;
+
+            Size qs = w;
+
+            while (qs > 1 && q[qs - 1] == 0) {
+                qs -= 1;
+            }
+
+            if (4 * qs >= 3 * w) {
+                mullow_n(lo, q, d, w);
+            }
+            else {
+                mul(lo, d, k, q, qs);
+            }
+
+            sub_n(r, r, lo, w);
+
+            while (cmp_n(r, d, w) >= 0) {
+                sub_n(r, r, d, w);
+                add_1(q, q, w, Word(1));
+            }
+
+            Whole_Number::Reg qr(w, 0);
+            Whole_Number::Reg rr(w, 0);
+
+            for (Size i = 0; i < w; i += 1) {
+                qr.at_reg(i) = q[i];
+                rr.at_reg(i) = r[i];
+            }
+
+            qot._reg = std::move(qr.trim());
+            rem._reg = std::move(rr.trim());
+        }
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+#include "Whole_Number.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                                'Divisor' Class Declaration
+        //
+        //        A whole number prepared for repeated division, with its reciprocal computed
+        //        once so each division takes multiplications rather than a long division.  A
+        //        single limb divisor keeps the word reciprocal of 'div_preinv'.  A divisor of
+        //        BARRETT_LIMBS limbs or more keeps m = floor(B^2k / d) for its k limbs, and a
+        //        dividend of 2k limbs is divided by Barrett's method:
+        //
+        //            q = ((n >> (k - 1) limbs) * m) >> (k + 1) limbs
+        //
+        //        which is short of the quotient by at most two, put right by subtracting d.  A
+        //        longer dividend is divided k limbs at a time.  Other divisors fall back on
+        //        the long division of 'Whole_Number::div_rem'.
+        //
+        /********************************************************************************************/
+
+        class Divisor {
+
+        public:
+            typedef Whole_Number::Word Word;
+
+            static const Size BARRETT_LIMBS = 112;  // The fewest divisor limbs divided by reciprocal.
+
+            Divisor();
+            Divisor(const Whole_Number& d);
+            virtual ~Divisor();
+
+            Divisor(Divisor&& obj)                 = default;
+            Divisor(const Divisor& obj)            = default;
+            Divisor& operator=(const Divisor& obj) = default;
+            Divisor& operator=(Divisor&& obj)      = default;
+
+            Boolean is() const;                                 // Whether a non zero divisor is held.
+
+            void div_rem(const Whole_Number& n, Whole_Number& qot, Whole_Number& rem) const;
+
+            const Whole_Number& get_Whole_Number() const;
+
+        private:
+
+            Whole_Number _d;
+            Size         _limbs;
+            Size         _shift;        // Of a single limb, the shift that normalizes it,
+            Word         _inverse;      // and the reciprocal of the normalized word.
+            Whole_Number _reciprocal;   // Of a Barrett divisor, floor(B^2k / d).
+
+            void barrett(const Whole_Number& n, Whole_Number& qot, Whole_Number& rem) const;  // For n < B^2k.
+        };
+    }
+}
@@ -0,0 +1,54 @@
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+
+#include "Literals.h"
+
+namespace Olly {
+    namespace APM {
+
+        Whole_Number Number_Literal::whole(const Word* limbs, Size size) {
+
+            Whole_Number::Reg reg(size, 0);
+
+            for (Size i = 0; i < size; ++i) {
+                reg.at_reg(i) = limbs[i];
+            }
+
+            return Whole_Number(reg.trim());
+        }
+
+        Decimal Number_Literal::decimal(const Whole_Number& number, Size scale) {
+
+            Decimal a;
+
+            a._number = Integer(number);
+            a._scale  = scale;
+
+            a.rescale(Decimal::decimal_scale());
+
+            return a;
+        }
+    }
+}
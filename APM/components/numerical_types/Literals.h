@@ -0,0 +1,499 @@
+#pragma once
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+
+#include <array>
+#include <stdexcept>
+#include "Whole_Number.h"
+#include "Integer.h"
+#include "Decimal.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                              'Whole_Constant' Class Declaration
+        //
+        //        A whole number of at most 'LIMBS' limbs with constexpr arithmetic, built on the
+        //        constexpr kernels of 'Limb_Kernels.h', so a table of constants is computed by
+        //        the compiler.  A result which does not fit in 'LIMBS' limbs, or a difference
+        //        below zero, throws; within a constant expression that is a compile error.
+        //
+        /********************************************************************************************/
+
+        template<Size LIMBS>
+        class Whole_Constant {
+
+        public:
+
+            typedef Whole_Number::Word Word;
+
+            constexpr Whole_Constant();
+            constexpr Whole_Constant(Word value);
+
+            constexpr Size        size_limbs() const;     // The significant limbs, at least one.
+            constexpr const Word* data()       const;
+
+            constexpr Boolean is() const;
+
+            constexpr sys_float compare(const Whole_Constant& b) const;
+
+            constexpr Boolean operator==(const Whole_Constant& b) const;
+            constexpr Boolean operator!=(const Whole_Constant& b) const;
+            constexpr Boolean operator< (const Whole_Constant& b) const;
+            constexpr Boolean operator> (const Whole_Constant& b) const;
+
+            constexpr Whole_Constant operator+(const Whole_Constant& b) const;
+            constexpr Whole_Constant operator-(const Whole_Constant& b) const;
+            constexpr Whole_Constant operator*(const Whole_Constant& b) const;
+
+            constexpr Whole_Constant operator<<(Size bits) const;
+            constexpr Whole_Constant operator>>(Size bits) const;
+
+            constexpr Whole_Constant mul_add(Word m, Word a) const;     // *this * m + a.
+
+            Whole_Number get_Whole_Number() const;                      // Copy the limbs at run time.
+
+        private:
+
+            std::array<Word, LIMBS> _limbs;
+        };
+
+        /********************************************************************************************/
+        //
+        //                              'Number_Literal' Class Declaration
+        //
+        //        Parses the characters of a numeric literal at compile time.  Whole literals
+        //        are written as in C++: decimal, octal with a leading 0, hexadecimal with 0x, or
+        //        binary with 0b, with optional ' separators.  Decimal literals are base 10 with
+        //        an optional point and exponent.  The run time cost of a literal is only the copy
+        //        of its limbs, and for a Decimal the rescale to the current scale.
+        //
+        /********************************************************************************************/
+
+        class Number_Literal {
+
+        public:
+
+            typedef Whole_Number::Word Word;
+
+            template<Size LIMBS>
+            struct Parsed {
+                Whole_Constant<LIMBS> number;
+                Size                  scale = 0;          // Digits after the point, less the exponent.
+                Boolean               valid = false;
+            };
+
+            template<char... C>
+            static consteval Size limbs();                // Enough limbs for the value of the literal.
+
+            template<Size LIMBS, char... C>
+            static consteval Parsed<LIMBS> parse(Boolean fraction);
+
+            static Whole_Number whole(const Word* limbs, Size size);
+            static Decimal      decimal(const Whole_Number& number, Size scale);
+
+        private:
+
+            static constexpr sys_int digit(char c, Size base);          // The value of the digit, or -1.
+        };
+
+        namespace literals {
+
+            template<char... C> Whole_Number operator""_wn();           // 12345_wn, 0xffff_wn.
+            template<char... C> Integer      operator""_int();          // Negate with a unary minus: -5_int.
+            template<char... C> Decimal      operator""_dec();          // 0.5_dec, 1.5e-3_dec, at the current scale.
+        }
+
+        /********************************************************************************************/
+        //
+        //                              'Whole_Constant' Implementation
+        //
+        /********************************************************************************************/
+
+        template<Size LIMBS>
+        constexpr Whole_Constant<LIMBS>::Whole_Constant() : _limbs() {
+        }
+
+        template<Size LIMBS>
+        constexpr Whole_Constant<LIMBS>::Whole_Constant(Word value) : _limbs() {
+            _limbs[0] = value;
+        }
+
+        template<Size LIMBS>
+        constexpr Size Whole_Constant<LIMBS>::size_limbs() const {
+
+            Size size = LIMBS;
+
+            while (size > 1 && _limbs[size - 1] == 0) {
+                size -= 1;
+            }
+
+            return size;
+        }
+
+        template<Size LIMBS>
+        constexpr const typename Whole_Constant<LIMBS>::Word* Whole_Constant<LIMBS>::data() const {
+            return _limbs.data();
+        }
+
+        template<Size LIMBS>
+        constexpr Boolean Whole_Constant<LIMBS>::is() const {
+            return size_limbs() > 1 || _limbs[0] != 0;
+        }
+
+        template<Size LIMBS>
+        constexpr sys_float Whole_Constant<LIMBS>::compare(const Whole_Constant& b) const {
+            return static_cast<sys_float>(cmp_n<Word>(_limbs.data(), b._limbs.data(), LIMBS));
+        }
+
+        template<Size LIMBS>
+        constexpr Boolean Whole_Constant<LIMBS>::operator==(const Whole_Constant& b) const {
+            return compare(b) == 0;
+        }
+
+        template<Size LIMBS>
+        constexpr Boolean Whole_Constant<LIMBS>::operator!=(const Whole_Constant& b) const {
+            return compare(b) != 0;
+        }
+
+        template<Size LIMBS>
+        constexpr Boolean Whole_Constant<LIMBS>::operator<(const Whole_Constant& b) const {
+            return compare(b) < 0;
+        }
+
+        template<Size LIMBS>
+        constexpr Boolean Whole_Constant<LIMBS>::operator>(const Whole_Constant& b) const {
+            return compare(b) > 0;
+        }
+
+        template<Size LIMBS>
+        constexpr Whole_Constant<LIMBS> Whole_Constant<LIMBS>::operator+(const Whole_Constant& b) const {
+
+            Whole_Constant a;
+
+            if (add_n<Word>(a._limbs.data(), _limbs.data(), b._limbs.data(), LIMBS)) {
+                throw std::overflow_error("Whole_Constant: the sum does not fit.");
+            }
+
+            return a;
+        }
+
+        template<Size LIMBS>
+        constexpr Whole_Constant<LIMBS> Whole_Constant<LIMBS>::operator-(const Whole_Constant& b) const {
+
+            Whole_Constant a;
+
+            if (sub_n<Word>(a._limbs.data(), _limbs.data(), b._limbs.data(), LIMBS)) {
+                throw std::underflow_error("Whole_Constant: the difference is negative.");
+            }
+
+            return a;
+        }
+
+        template<Size LIMBS>
+        constexpr Whole_Constant<LIMBS> Whole_Constant<LIMBS>::operator*(const Whole_Constant& b) const {
+            /*
+                The basecase product, row by row, where any carry out of the top
+                limb, or row past it, means the product does not fit.
+            */
+
+            Whole_Constant a;
+
+            const Size size_a = size_limbs();
+            const Size size_b = b.size_limbs();
+
+            for (Size j = 0; j < size_b; j += 1) {
+
+                if (b._limbs[j] == 0) {
+                    continue;
+                }
+
+                Size n = (size_a < LIMBS - j) ? size_a : LIMBS - j;
+
+                Word carry = addmul_1<Word>(a._limbs.data() + j, _limbs.data(), n, b._limbs[j]);
+
+                if (n < size_a) {
+                    throw std::overflow_error("Whole_Constant: the product does not fit.");
+                }
+
+                if (carry && (j + n >= LIMBS || add_1<Word>(a._limbs.data() + j + n, a._limbs.data() + j + n, LIMBS - j - n, carry))) {
+                    throw std::overflow_error("Whole_Constant: the product does not fit.");
+                }
+            }
+
+            return a;
+        }
+
+        template<Size LIMBS>
+        constexpr Whole_Constant<LIMBS> Whole_Constant<LIMBS>::operator<<(Size bits) const {
+
+            const Size words = bits / Limb_Traits<Word>::BITS;
+
+            Whole_Constant a;
+
+            if (words >= LIMBS) {
+
+                if (is()) {
+                    throw std::overflow_error("Whole_Constant: the shift does not fit.");
+                }
+
+                return a;
+            }
+
+            Word out = lshift<Word>(a._limbs.data() + words, _limbs.data(), LIMBS - words, bits % Limb_Traits<Word>::BITS);
+
+            if (out || size_limbs() > LIMBS - words) {
+                throw std::overflow_error("Whole_Constant: the shift does not fit.");
+            }
+
+            return a;
+        }
+
+        template<Size LIMBS>
+        constexpr Whole_Constant<LIMBS> Whole_Constant<LIMBS>::operator>>(Size bits) const {
+
+            const Size words = bits / Limb_Traits<Word>::BITS;
+
+            Whole_Constant a;
+
+            if (words < LIMBS) {
+                rshift<Word>(a._limbs.data(), _limbs.data() + words, LIMBS - words, bits % Limb_Traits<Word>::BITS);
+            }
+
+            return a;
+        }
+
+        template<Size LIMBS>
+        constexpr Whole_Constant<LIMBS> Whole_Constant<LIMBS>::mul_add(Word m, Word a) const {
+
+            Whole_Constant b;
+
+            Word carry = mul_1<Word>(b._limbs.data(), _limbs.data(), LIMBS, m);
+
+            carry += add_1<Word>(b._limbs.data(), b._limbs.data(), LIMBS, a);
+
+            if (carry) {
+                throw std::overflow_error("Whole_Constant: the value does not fit.");
+            }
+
+            return b;
+        }
+
+        template<Size LIMBS>
+        inline Whole_Number Whole_Constant<LIMBS>::get_Whole_Number() const {
+            return Number_Literal::whole(_limbs.data(), size_limbs());
+        }
+
+        /********************************************************************************************/
+        //
+        //                              'Number_Literal' Implementation
+        //
+        /********************************************************************************************/
+
+        constexpr sys_int Number_Literal::digit(char c, Size base) {
+
+            sys_int value = -1;
+
+            if (c >= '0' && c <= '9') {
+                value = c - '0';
+            }
+            else if (c >= 'a' && c <= 'f') {
+                value = c - 'a' + 10;
+            }
+            else if (c >= 'A' && c <= 'F') {
+                value = c - 'A' + 10;
+            }
+
+            return (value >= 0 && static_cast<Size>(value) < base) ? value : -1;
+        }
+
+        template<char... C>
+        consteval Size Number_Literal::limbs() {
+            /*
+                Four bits hold any digit of the bases, and a positive exponent adds
+                at most four bits a power of ten.
+            */
+
+            const char text[] = { C... };
+
+            Size count    = sizeof...(C);
+            Size exponent = 0;
+
+            for (Size i = 0; i < count; i += 1) {
+
+                if ((text[i] == 'e' || text[i] == 'E') && !(count > 1 && (text[1] == 'x' || text[1] == 'X'))) {
+
+                    for (Size j = i + 1; j < count; j += 1) {
+
+                        if (text[j] >= '0' && text[j] <= '9') {
+                            exponent = exponent * 10 + static_cast<Size>(text[j] - '0');
+                        }
+                    }
+
+                    break;
+                }
+            }
+
+            return (4 * (count + exponent)) / Limb_Traits<Word>::BITS + 1;
+        }
+
+        template<Size LIMBS, char... C>
+        consteval Number_Literal::Parsed<LIMBS> Number_Literal::parse(Boolean fraction) {
+
+            const char text[] = { C..., '\0' };
+            const Size count  = sizeof...(C);
+
+            Parsed<LIMBS> result;
+
+            Size base = 10;
+            Size i    = 0;
+
+            if (fraction) {
+                // Always base 10, leading zeros included.
+            }
+            else if (count > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+                base = 16;
+                i    = 2;
+            }
+            else if (count > 2 && text[0] == '0' && (text[1] == 'b' || text[1] == 'B')) {
+                base = 2;
+                i    = 2;
+            }
+            else if (count > 1 && text[0] == '0') {
+                base = 8;
+                i    = 1;
+            }
+
+            Boolean point  = false;
+            Size    digits = 0;
+            Size    scale  = 0;
+
+            for (; i < count; i += 1) {
+
+                const char c = text[i];
+
+                if (c == '\'') {
+                    continue;
+                }
+
+                if (fraction && c == '.' && !point) {
+                    point = true;
+                    continue;
+                }
+
+                if (fraction && (c == 'e' || c == 'E')) {
+                    break;
+                }
+
+                sys_int value = digit(c, base);
+
+                if (value < 0) {
+                    return result;
+                }
+
+                result.number = result.number.mul_add(static_cast<Word>(base), static_cast<Word>(value));
+
+                digits += 1;
+                scale  += point ? 1 : 0;
+            }
+
+            sys_int exponent = 0;
+
+            if (i < count) {
+
+                Boolean negative = false;
+                Size    j        = i + 1;
+
+                if (j < count && (text[j] == '+' || text[j] == '-')) {
+                    negative = text[j] == '-';
+                    j       += 1;
+                }
+
+                if (j == count) {
+                    return result;
+                }
+
+                for (; j < count; j += 1) {
+
+                    sys_int value = digit(text[j], 10);
+
+                    if (value < 0) {
+                        return result;
+                    }
+
+                    exponent = exponent * 10 + value;
+                }
+
+                exponent = negative ? -exponent : exponent;
+            }
+
+            sys_int places = static_cast<sys_int>(scale) - exponent;
+
+            for (; places < 0; places += 1) {
+                result.number = result.number.mul_add(10, 0);
+            }
+
+            result.scale = static_cast<Size>(places);
+            result.valid = digits > 0;
+
+            return result;
+        }
+
+        namespace literals {
+
+            template<char... C>
+            inline Whole_Number operator""_wn() {
+
+                static constexpr auto value = Number_Literal::parse<Number_Literal::limbs<C...>(), C...>(false);
+
+                static_assert(value.valid, "Not a whole number literal.");
+
+                return value.number.get_Whole_Number();
+            }
+
+            template<char... C>
+            inline Integer operator""_int() {
+
+                static constexpr auto value = Number_Literal::parse<Number_Literal::limbs<C...>(), C...>(false);
+
+                static_assert(value.valid, "Not an integer literal.");
+
+                return Integer(value.number.get_Whole_Number());
+            }
+
+            template<char... C>
+            inline Decimal operator""_dec() {
+
+                static constexpr auto value = Number_Literal::parse<Number_Literal::limbs<C...>(), C...>(true);
+
+                static_assert(value.valid, "Not a decimal literal.");
+
+                return Number_Literal::decimal(value.number.get_Whole_Number(), value.scale);
+            }
+        }
+    }
+}
@@ -0,0 +1,182 @@
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+
+#include <map>
+#include <mutex>
+#include "Power_Cache.h"
+
+namespace Olly {
+    namespace APM {
+
+        typedef Power_Cache::Word Word;
+
+        struct Power_Store {
+
+            std::mutex                                   lock;
+            std::map<std::pair<Word, Size>, Whole_Number> powers;     // radix^k by radix and k.
+            std::map<Word, std::vector<Whole_Number>>     ladders;    // The rungs held of each chunk.
+            Size                                         limbs = 0;  // Of all the powers held.
+        };
+
+        static Power_Store& power_store() {
+
+            static Power_Store* store = new Power_Store();  // Never destroyed, as pool threads may exit late.
+
+            return *store;
+        }
+
+        Whole_Number Power_Cache::power(Word radix, Size k) {
+
+            Power_Store& store = power_store();
+
+            const std::pair<Word, Size> key(radix, k);
+
+            {
+                std::lock_guard<std::mutex> hold(store.lock);
+
+                auto found = store.powers.find(key);
+
+                if (found != store.powers.end()) {
+                    return found->second;
+                }
+            }
+
+            Whole_Number p = Whole_Number(radix).pow(k);
+
+            std::lock_guard<std::mutex> hold(store.lock);
+
+            Size size = limbs(p);
+
+            if (store.limbs + size <= CACHE_LIMBS) {
+
+                auto placed = store.powers.emplace(key, p);
+
+                if (placed.second) {
+                    store.limbs += size;
+                }
+
+                return placed.first->second;
+            }
+
+            return p;
+        }
+
+        std::vector<Whole_Number> Power_Cache::ladder(Word chunk, Size levels) {
+
+            std::vector<Whole_Number> rungs;
+
+            rungs.reserve(levels);
+
+            {
+                Power_Store& store = power_store();
+
+                std::lock_guard<std::mutex> hold(store.lock);
+
+                const std::vector<Whole_Number>& held = store.ladders[chunk];
+
+                for (Size i = 0; i < held.size() && i < levels; ++i) {
+                    rungs.push_back(held[i]);
+                }
+            }
+
+            if (rungs.size() == levels) {
+                return rungs;
+            }
+
+            if (rungs.empty()) {
+                rungs.push_back(Whole_Number(chunk));
+            }
+
+            while (rungs.size() < levels) {
+                rungs.push_back(rungs.back() * rungs.back());
+            }
+
+            keep(chunk, rungs);
+
+            return rungs;
+        }
+
+        std::vector<Whole_Number> Power_Cache::ladder(Word chunk, const Whole_Number& n) {
+
+            std::vector<Whole_Number> rungs;
+
+            {
+                Power_Store& store = power_store();
+
+                std::lock_guard<std::mutex> hold(store.lock);
+
+                const std::vector<Whole_Number>& held = store.ladders[chunk];
+
+                for (Size i = 0; i < held.size() && (rungs.empty() || rungs.back() <= n); ++i) {
+                    rungs.push_back(held[i]);
+                }
+            }
+
+            if (!rungs.empty() && n < rungs.back()) {
+                return rungs;
+            }
+
+            if (rungs.empty()) {
+                rungs.push_back(Whole_Number(chunk));
+            }
+
+            while (rungs.back() <= n) {
+                rungs.push_back(rungs.back() * rungs.back());
+            }
+
+            keep(chunk, rungs);
+
+            return rungs;
+        }
+
+        void Power_Cache::keep(Word chunk, const std::vector<Whole_Number>& rungs) {
+            /*
+                Hold any rungs past those already held, while they fit in the cache.
+            */
+            Power_Store& store = power_store();
+
+            std::lock_guard<std::mutex> hold(store.lock);
+
+            std::vector<Whole_Number>& held = store.ladders[chunk];
+
+            while (held.size() < rungs.size()) {
+
+                Size size = limbs(rungs[held.size()]);
+
+                if (store.limbs + size > CACHE_LIMBS) {
+                    break;
+                }
+
+                store.limbs += size;
+
+                held.push_back(rungs[held.size()]);
+            }
+        }
+
+        Size Power_Cache::limbs(const Whole_Number& n) {
+            return n.size_limbs();
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+
+#include <vector>
+#include "Whole_Number.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                              'Power_Cache' Class Declaration
+        //
+        //        The powers of a radix, shared by every thread and grown as they are asked
+        //        for.  'power' holds radix^k by k, for the scaling of a Decimal and the tails
+        //        of parsed text.  'ladder' holds chunk^(2^i), the rungs the divide and conquer
+        //        radix conversions halve a number by.  A power is computed outside the lock,
+        //        so two threads may both compute one, and the first stored is kept.
+        //
+        //        The cached numbers are never changed, so a copy handed out shares their limbs
+        //        until it is written to.  Once CACHE_LIMBS limbs are held, a power not yet held
+        //        is computed and returned without being kept.
+        //
+        /********************************************************************************************/
+
+        class Power_Cache {
+
+        public:
+            typedef Whole_Number::Word Word;
+
+            static const Size CACHE_LIMBS = Size(1) << 22;  // The most limbs of powers held at once.
+
+            static Whole_Number power(Word radix, Size k);                                  // radix^k.
+
+            static std::vector<Whole_Number> ladder(Word chunk, Size levels);               // chunk^(2^i) for i < levels.
+            static std::vector<Whole_Number> ladder(Word chunk, const Whole_Number& n);     // Up to the first rung above n.
+
+        private:
+
+            static void keep(Word chunk, const std::vector<Whole_Number>& rungs);   // Hold the rungs not yet held.
+            static Size limbs(const Whole_Number& n);
+        };
+    }
+}
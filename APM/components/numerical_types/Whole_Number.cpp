@@ -1,743 +1,1404 @@
-
-/*********************************************************************/
-//
-//			Copyright 2022 Max J. Martin
-//
-//			This file is part of APM.
-// 
-//			APM is free software : you can redistribute it
-//			and /or modify it under the terms of the GNU General
-//			Public License as published by the Free Software
-//			Foundation, either version 3 of the License, or
-//			(at your option) any later version.
-//			
-//			APM is distributed in the hope that it will be
-//			useful, but WITHOUT ANY WARRANTY; without even the
-//			implied warranty of MERCHANTABILITY or FITNESS FOR
-//			A PARTICULAR PURPOSE.See the GNU General Public
-//			
-//			You should have received a copy of the GNU General
-//			Public License along with APM.If not, see
-//			< https://www.gnu.org/licenses/>.
-//			
-/*********************************************************************/
-
-#include "Whole_Number.h"
-
-namespace Olly {
-    namespace APM {
-
-        Whole_Number::Whole_Number() : _reg() {
-        }
-
-        Whole_Number::Whole_Number(Word value) : _reg(1, value) {
-        }
-
-        Whole_Number::Whole_Number(const Text& value, Word base) : _reg() {
-            set_numeric_value(value, base);
-        }
-
-        Whole_Number::Whole_Number(const Text& value, Word base, Boolean& error) : _reg() {
-            error = set_numeric_value(value, base);
-        }
-
-        Whole_Number::Whole_Number(const Reg& reg) : _reg(reg) {
-        }
-
-        Whole_Number::~Whole_Number() {
-        }
-
-        Boolean Whole_Number::is() const {
-            return _reg.is();
-        }
-
-        Boolean Whole_Number::is_odd() const {
-            return _reg.last_reg() & 1;
-        }
-
-        Boolean Whole_Number::is_even() const {
-            return !is_odd();
-        }
-
-        Boolean Whole_Number::operator==(const Whole_Number& b) const {
-            return compare(b) == 0;
-        }
-
-        Boolean Whole_Number::operator!=(const Whole_Number& b) const {
-            return compare(b) != 0;
-        }
-
-        Boolean Whole_Number::operator>=(const Whole_Number& b) const {
-            return compare(b) >= 0;
-        }
-
-        Boolean Whole_Number::operator<=(const Whole_Number& b) const {
-            return compare(b) <= 0;
-        }
-
-        Boolean Whole_Number::operator>(const Whole_Number& b) const {
-            return compare(b) > 0;
-        }
-
-        Boolean Whole_Number::operator<(const Whole_Number& b) const {
-            return compare(b) < 0;
-        }
-
-        sys_float Whole_Number::compare(const Whole_Number& other) const {
-            return _reg.compare(other._reg);
-        }
-
-        Whole_Number& Whole_Number::operator&=(const Whole_Number& other) {
-            _reg &= other._reg;
-
-            trim();
-
-            return *this;
-        }
-
-        Whole_Number& Whole_Number::operator|=(const Whole_Number& other) {
-            _reg |= other._reg;
-
-            trim();
-
-            return *this;
-        }
-
-        Whole_Number& Whole_Number::operator^=(const Whole_Number& other) {
-            _reg ^= other._reg;
-
-            trim();
-
-            return *this;
-        }
-
-        Whole_Number& Whole_Number::operator<<=(Size index) {
-            _reg <<= index;
-
-            trim();
-
-            return *this;
-        }
-
-        Whole_Number& Whole_Number::operator>>=(Size index) {
-            _reg >>= index;
-
-            trim();
-
-            return *this;
-        }
-
-        Whole_Number Whole_Number::bin_comp() const {
-
-            Whole_Number n;
-
-            n._reg = _reg.bin_comp();
-
-            return n;
-        }
-
-        Whole_Number Whole_Number::operator&(const Whole_Number& b) const {
-
-            Whole_Number a = *this;
-
-            a &= b;
-
-            return a;
-        }
-
-        Whole_Number Whole_Number::operator|(const Whole_Number& b) const {
-
-            Whole_Number a = *this;
-
-            a |= b;
-
-            return a;
-        }
-
-        Whole_Number Whole_Number::operator^(const Whole_Number& b) const {
-
-            Whole_Number a = *this;
-
-            a ^= b;
-
-            return a;
-        }
-
-        Whole_Number Whole_Number::operator~() const {
-
-            Whole_Number a;
-
-            a._reg = ~_reg;
-
-            return a;
-        }
-
-        Whole_Number Whole_Number::operator<<(Size index) const {
-
-            Whole_Number a = *this;
-
-            a <<= index;
-
-            return a;
-        }
-
-        Whole_Number Whole_Number::operator>>(Size index) const {
-
-            Whole_Number a = *this;
-
-            a >>= index;
-
-            return a;
-        }
-
-        Whole_Number& Whole_Number::operator+=(const Whole_Number& other) {
-
-            Size limit = _reg.size_regs() > other._reg.size_regs() ? _reg.size_regs() : other._reg.size_regs();
-
-            Double_Word n = 0;
-
-            for (Size i = 0; i < limit; i += 1) {
-
-                n = n + _reg.at_reg(i) + other._reg.at_reg(i);
-
-                _reg.at_reg(i) = static_cast<Word>(n);
-
-                n >>= _reg.BITS;
-            }
-
-            if (n != 0) {
-
-                _reg.at_reg(limit) = static_cast<Word>(n);
-            }
-
-            trim();
-
-            return *this;
-        }
-
-        Whole_Number& Whole_Number::operator-=(const Whole_Number& other) {
-
-            if (other > *this) {
-                *this = Whole_Number();
-                return *this;
-            }
-
-            Size limit = _reg.size_regs() > other._reg.size_regs() ? _reg.size_regs() : other._reg.size_regs();
-
-            Double_Word n = 0;
-
-            for (Size i = 0; i < limit; i += 1) {
-
-                n = n + _reg.at_reg(i) - other._reg.at_reg(i);
-
-                _reg.at_reg(i) = static_cast<Word>(n);
-
-                n = ((n >> _reg.BITS) ? -1 : 0);
-            }
-
-            trim();
-
-            return *this;
-        }
-
-        Whole_Number& Whole_Number::operator*=(const Whole_Number& other) {
-
-            *this = *this * other;
-
-            return *this;
-        }
-
-        Whole_Number& Whole_Number::operator/=(const Whole_Number& other) {
-
-            *this = *this / other;
-
-            return *this;
-        }
-
-        Whole_Number& Whole_Number::operator%=(const Whole_Number& other) {
-
-            *this = *this % other;
-
-            return *this;
-        }
-
-        Whole_Number Whole_Number::operator+(const Whole_Number& b) const {
-
-            Whole_Number a = *this;
-
-            a += b;
-
-            return a;
-        }
-
-        Whole_Number Whole_Number::operator-(const Whole_Number& b) const {
-
-            Whole_Number a = *this;
-
-            a -= b;
-
-            return a;
-        }
-
-        Whole_Number Whole_Number::operator*(const Whole_Number& b) const {
-
-            Size size_a = _reg.size_regs();
-            Size size_b = b._reg.size_regs();
-
-            Reg r((size_a + size_b + 1), 0);
-
-            for (Size j = 0; j < size_b; j += 1) {
-
-                Double_Word n = 0;
-
-                for (Size i = 0; i < size_a; i += 1) {
-
-                    Size k = i + j;
-
-                    n += static_cast<Double_Word>(_reg.at_reg(i)) * b._reg.at_reg(j) + r.at_reg(k);
-
-                    r.at_reg(k) = static_cast<Word>(n);
-
-                    n >>= _reg.BITS;
-                }
-                r.at_reg(j + size_a) = static_cast<Word>(n);
-            }
-
-            r.trim();
-
-            return r;
-        }
-
-        Whole_Number Whole_Number::operator/(const Whole_Number& b) const {
-
-            Whole_Number q;
-            Whole_Number r;
-
-            div_rem(b, q, r);
-
-            return q;
-        }
-
-        Whole_Number Whole_Number::operator%(const Whole_Number& b) const {
-
-            Whole_Number q;
-            Whole_Number r;
-
-            div_rem(b, q, r);
-
-            return r;
-        }
-
-        Whole_Number& Whole_Number::operator++() {
-
-            ++_reg;
-
-            trim();
-
-            return *this;
-        }
-
-        Whole_Number Whole_Number::operator++(int) {
-
-            Whole_Number a(*this);
-
-            operator++();
-
-            return a;
-        }
-
-        Whole_Number& Whole_Number::operator--() {
-
-            --_reg;
-
-            trim();
-
-            return *this;
-        }
-
-        Whole_Number Whole_Number::operator--(int) {
-
-            Whole_Number a(*this);
-
-            operator--();
-
-            return a;
-        }
-
-        void Whole_Number::div_rem(const Whole_Number& other, Whole_Number& qot, Whole_Number& rem) const {
-
-            // Ensure both the qotient and remander are initalized to zero.
-            qot = Whole_Number();
-            rem = Whole_Number();
-
-            if (!other.is()) {
-                // Division by zero.
-                return;
-            }
-
-            if (other > *this) {
-                // Division by a greater value.
-                qot = Whole_Number();
-                rem = *this;
-                return;
-            }
-
-            if (*this > other) {
-
-                if (other._reg.size_regs() == 1) {
-
-                    divide_remainder(other._reg.at_reg(0), qot, rem, 0);
-
-                    return;
-                }
-
-                sys_int stop = static_cast<sys_int>(other._reg.size_regs() - 1);
-
-                auto d = other._reg.at_reg(stop);
-
-                for (sys_int i = stop - 1; i >= 0; i -= 1) {
-                    // Add one to 'd' if any other digits are defined.
-                    if (other._reg.at_reg(i) != 0) {
-                        d += 1;
-                        break;
-                    }
-                }
-
-                // Perform long division.
-                Whole_Number n = *this;
-
-                Whole_Number q = Whole_Number();
-
-                Whole_Number guard = Whole_Number();
-
-                while (n >= other && n != guard) {
-
-                    n.divide_remainder(d, q, rem, stop);
-
-                    qot += q;
-
-                    guard = n;
-
-                    n -= (other * q);
-
-                    q = Whole_Number();
-                }
-
-                // Confirm the qoutent is correct.
-                q = other * qot;
-
-                while (q < *this) {
-                    qot += Whole_Number(1);
-                    q += other;
-                }
-
-                while (q > *this) {
-                    qot -= Whole_Number(1);
-                    q -= other;
-                }
-
-                // Determine the remainder.
-                rem = *this - q;
-                return;
-            }
-
-            // Return  division by two equal values.
-            qot = Whole_Number(1);
-            rem = Whole_Number();
-        }
-
-        Whole_Number Whole_Number::pow(Size b) const {
-
-            if (b == 2) {
-                Whole_Number a = *this;
-                return a * a;
-            }
-
-            if (b == 1) {
-                return *this;
-            }
-            
-            if (b == 0) {
-                return 1;
-            }
-
-            Whole_Number a = *this;
-            Whole_Number res = 1;
-
-            while (b) {
-
-                if (b & 1) {
-
-                    res *= a;
-                }
-
-                b >>= 1;
-
-                if (b) {
-                    a *= a;
-                }
-            }
-
-            return res;
-        }
-
-        Whole_Number Whole_Number::sqrt() const {
-            return static_cast<Word>(_reg.lead_bit() - 1);
-        }
-
-        Whole_Number Whole_Number::root(const Whole_Number& b) const {
-
-            Size n = b.to_integral<Size>();
-
-            Whole_Number low = 0;
-            Whole_Number high = 1;
-
-            while (high.pow(n) <= *this) {
-                low = high;
-                high *= 2;
-            }
-
-            while (low != high - 1) {
-
-                Whole_Number step = (high - low) / 2;
-
-                Whole_Number candidate = low + step;
-
-                auto value = candidate.pow(n);
-
-                if (value == *this) {
-                    return candidate;
-                }
-                if (value < *this) {
-                    low = candidate;
-                }
-                else {
-                    high = candidate;
-                }
-            }
-
-            return low;
-        }
-
-        Text Whole_Number::to_string() const {
-            return to_string(10);
-        }
-
-        Text Whole_Number::to_string(Size base) const {
-
-            if (base == 10 || base == 0 || base == 2 || base == 8 || base == 16) {
-
-                if (!is()) {
-                    return "0";
-                }
-
-                Whole_Number radix = static_cast<Word>(base != 0 ? base : 10);
-                Whole_Number n = *this;
-
-                Text_Stream stream;
-
-                int count = 0;
-
-                while (n.is()) {
-
-                    Whole_Number q;
-                    Whole_Number r = n;
-
-                    n.div_rem(radix, q, r);
-
-                    n = q;
-
-                    if (base == 16) {
-                        stream << std::hex << r._reg.at_reg(0);
-                    }
-                    else if (base == 8) {
-                        stream << std::oct << r._reg.at_reg(0);
-                    }
-                    else {
-                        stream << r._reg.at_reg(0);
-                    }
-
-                    if (base == 10) {
-                        count += 1;
-
-                        if (count == 3) {
-                            stream << ',';
-                            count = 0;
-                        }
-                    }
-                }
-                Text res = stream.str();
-
-                if (res.back() == ',') {
-                    res.pop_back();
-                }
-
-                std::reverse(res.begin(), res.end());
-
-                switch (base) {
-
-                case (2):
-                    res = "0b" + res;
-                    break;
-
-                case (8):
-                    res = "0o" + res;
-                    break;
-
-                case (16):
-                    res = "0x" + res;
-                    break;
-                }
-
-                return res;
-            }
-
-            return "";
-        }
-
-        const Whole_Number::Reg& Whole_Number::get_Binary_Register() const {
-            return _reg;
-        }
-
-        void Whole_Number::divide_remainder(Word d, Whole_Number& q, Whole_Number& r, sys_int stop) const {
-
-            Double_Word n(0);
-
-            for (sys_int i = static_cast<sys_int>(_reg.size_regs() - 1); i >= stop; i -= 1) {
-
-                n += _reg.at_reg(i);
-
-                q._reg.at_reg(static_cast<Size>(i) - stop) = static_cast<Word>(n / d);
-
-                n %= d;
-                n <<= _reg.BITS;
-            }
-
-            r._reg.at_reg(0) = n >> _reg.BITS;
-
-            return;
-        }
-
-        Boolean Whole_Number::set_numeric_value(const Text& text, const Word& base) {
-
-            if (base == 10) {  // Parse a decimal number.
-
-                Word x = 0;
-
-                for (const auto n : text) {
-
-                    if (!std::isspace(n) && n != ',') {
-
-                        x = n - '0';
-
-                        if (x >= 0 && x < base) {
-
-                            operator*=(base);
-                            operator+=(x);
-                        }
-                        else {
-                            _reg = Reg();
-                            return true;
-                        }
-                    }
-                }
-            }
-
-            else if (base == 16) {  // Parse a hexidecimal number.
-
-                Word x;
-
-                for (const auto n : text) {
-
-                    if (!std::isspace(n)) {
-
-                        switch (n) {
-
-                        case('a'):
-                        case('A'):
-                            x = 10;
-                            break;
-                        case('b'):
-                        case('B'):
-                            x = 11;
-                            break;
-                        case('c'):
-                        case('C'):
-                            x = 12;
-                            break;
-                        case('d'):
-                        case('D'):
-                            x = 13;
-                            break;
-                        case('e'):
-                        case('E'):
-                            x = 14;
-                            break;
-                        case('f'):
-                        case('F'):
-                            x = 15;
-                            break;
-                        default:
-                            x = (n - '0');
-                        }
-
-                        if (x >= 0 && x < base) {
-
-                            operator*=(base);
-                            operator+=(x);
-                        }
-                        else {
-                            _reg = Reg();
-                            return true;
-                        }
-                    }
-                }
-            }
-
-            else if (base == 8) {  // Parse an octal number.
-
-                Word x;
-
-                for (const auto n : text) {
-
-                    if (!std::isspace(n)) {
-
-                        x = n - '0';
-
-                        if (x >= 0 && x < base) {
-
-                            operator*=(base);
-                            operator+=(x);
-                        }
-                        else {
-                            _reg = Reg();
-                            return true;
-                        }
-                    }
-                }
-            }
-
-            else if (base == 2) {  // Parse a binary number.
-
-                for (const auto n : text) {
-
-                    operator<<=(1);
-
-                    if (n == '1') {
-                        operator+=(1);
-                    }
-                    else if (n != '0') {
-                        _reg = Reg();
-                        return true;
-                    }
-                }
-            }
-
-            return false;
-        }
-
-        void Whole_Number::trim() {
-            _reg.trim();
-        }
-    }
-}
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+// 
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//			
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//			
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//			
+/*********************************************************************/
+
+#include <algorithm>
+#include <utility>
+#include "Whole_Number.h"
+#include "Power_Cache.h"
+#include "../Thread_Pool.h"
+
+namespace Olly {
+    namespace APM {
+
+        Whole_Number::Whole_Number() : _reg() {
+        }
+
+        Whole_Number::Whole_Number(Word value) : _reg(1, value) {
+        }
+
+        Whole_Number::Whole_Number(const Text& value, Word base) : _reg() {
+            set_numeric_value(value, base);
+        }
+
+        Whole_Number::Whole_Number(const Text& value, Word base, Boolean& error) : _reg() {
+            error = set_numeric_value(value, base);
+        }
+
+        Whole_Number::Whole_Number(const Reg& reg) : _reg(reg) {
+        }
+
+        Whole_Number::~Whole_Number() {
+        }
+
+        Boolean Whole_Number::is() const {
+            return _reg.is();
+        }
+
+        Boolean Whole_Number::is_odd() const {
+            return _reg.last_reg() & 1;
+        }
+
+        Boolean Whole_Number::is_even() const {
+            return !is_odd();
+        }
+
+        Boolean Whole_Number::operator==(const Whole_Number& b) const {
+            return compare(b) == 0;
+        }
+
+        Boolean Whole_Number::operator!=(const Whole_Number& b) const {
+            return compare(b) != 0;
+        }
+
+        Boolean Whole_Number::operator>=(const Whole_Number& b) const {
+            return compare(b) >= 0;
+        }
+
+        Boolean Whole_Number::operator<=(const Whole_Number& b) const {
+            return compare(b) <= 0;
+        }
+
+        Boolean Whole_Number::operator>(const Whole_Number& b) const {
+            return compare(b) > 0;
+        }
+
+        Boolean Whole_Number::operator<(const Whole_Number& b) const {
+            return compare(b) < 0;
+        }
+
+        Boolean Whole_Number::operator==(Word b) const {
+            return compare(b) == 0;
+        }
+
+        Boolean Whole_Number::operator!=(Word b) const {
+            return compare(b) != 0;
+        }
+
+        Boolean Whole_Number::operator>=(Word b) const {
+            return compare(b) >= 0;
+        }
+
+        Boolean Whole_Number::operator<=(Word b) const {
+            return compare(b) <= 0;
+        }
+
+        Boolean Whole_Number::operator>(Word b) const {
+            return compare(b) > 0;
+        }
+
+        Boolean Whole_Number::operator<(Word b) const {
+            return compare(b) < 0;
+        }
+
+        sys_float Whole_Number::compare(const Whole_Number& other) const {
+            return _reg.compare(other._reg);
+        }
+
+        sys_float Whole_Number::compare(Word other) const {
+
+            if (size_limbs() > 1) {
+                return 1.0;
+            }
+
+            Word a = _reg.at_reg(0);
+
+            if (a < other) {
+                return -1.0;
+            }
+
+            return a > other ? 1.0 : 0.0;
+        }
+
+        Whole_Number& Whole_Number::operator&=(const Whole_Number& other) {
+
+            Size size = std::min(size_limbs(), other.size_limbs());
+
+            and_n(_reg.data(), _reg.data(), other._reg.data(), size);
+
+            _reg.resize(size);
+
+            trim();
+
+            return *this;
+        }
+
+        Whole_Number& Whole_Number::operator|=(const Whole_Number& other) {
+
+            Size size = other.size_limbs();
+
+            if (size_limbs() < size) {
+                _reg.resize(size);
+            }
+
+            or_n(_reg.data(), _reg.data(), other._reg.data(), size);
+
+            trim();
+
+            return *this;
+        }
+
+        Whole_Number& Whole_Number::operator^=(const Whole_Number& other) {
+
+            Size size = other.size_limbs();
+
+            if (size_limbs() < size) {
+                _reg.resize(size);
+            }
+
+            xor_n(_reg.data(), _reg.data(), other._reg.data(), size);
+
+            trim();
+
+            return *this;
+        }
+
+        Whole_Number& Whole_Number::operator<<=(Size index) {
+
+            APM_COUNT(shift);
+
+            Size words = index / Reg::BITS;
+            Size bits  = index % Reg::BITS;
+            Size size  = size_limbs();
+
+            _reg.resize(size + words + 1);
+
+            Word* n = _reg.data();
+
+            n[size + words] = lshift(n + words, n, size, bits);
+
+            for (Size i = 0; i < words; i += 1) {
+                n[i] = 0;
+            }
+
+            trim();
+
+            return *this;
+        }
+
+        Whole_Number& Whole_Number::operator>>=(Size index) {
+
+            APM_COUNT(shift);
+
+            Size words = index / Reg::BITS;
+            Size bits  = index % Reg::BITS;
+            Size size  = size_limbs();
+
+            if (words >= size) {
+                *this = Whole_Number();
+                return *this;
+            }
+
+            Word* n = _reg.data();
+
+            rshift(n, n + words, size - words, bits);
+
+            _reg.resize(size - words);
+
+            trim();
+
+            return *this;
+        }
+
+        Whole_Number Whole_Number::bin_comp() const {
+
+            Whole_Number n;
+
+            n._reg = _reg.bin_comp();
+
+            return n;
+        }
+
+        Whole_Number Whole_Number::operator&(const Whole_Number& b) const {
+
+            Whole_Number a = *this;
+
+            a &= b;
+
+            return a;
+        }
+
+        Whole_Number Whole_Number::operator|(const Whole_Number& b) const {
+
+            Whole_Number a = *this;
+
+            a |= b;
+
+            return a;
+        }
+
+        Whole_Number Whole_Number::operator^(const Whole_Number& b) const {
+
+            Whole_Number a = *this;
+
+            a ^= b;
+
+            return a;
+        }
+
+        Whole_Number Whole_Number::operator~() const {
+
+            Size size = size_limbs();
+
+            Whole_Number a;
+
+            a._reg.resize(size);
+
+            com_n(a._reg.data(), _reg.data(), size);
+
+            return a;
+        }
+
+        Whole_Number Whole_Number::operator<<(Size index) const {
+
+            Whole_Number a = *this;
+
+            a <<= index;
+
+            return a;
+        }
+
+        Whole_Number Whole_Number::operator>>(Size index) const {
+
+            Whole_Number a = *this;
+
+            a >>= index;
+
+            return a;
+        }
+
+        Whole_Number& Whole_Number::operator+=(const Whole_Number& other) {
+
+            APM_COUNT(add);
+
+            Size size_a = size_limbs();
+            Size size_b = other.size_limbs();
+
+            if (size_a < size_b) {
+                _reg.resize(size_b);
+                size_a = size_b;
+            }
+
+            Word* a = _reg.data();
+
+            Word carry = add_n(a, a, other._reg.data(), size_b);
+
+            carry = add_1(a + size_b, a + size_b, size_a - size_b, carry);
+
+            if (carry != 0) {
+
+                _reg.at_reg(size_a) = carry;
+            }
+
+            trim();
+
+            return *this;
+        }
+
+        Whole_Number& Whole_Number::operator-=(const Whole_Number& other) {
+
+            APM_COUNT(sub);
+
+            if (other > *this) {
+                *this = Whole_Number();
+                return *this;
+            }
+
+            Size size_a = size_limbs();
+            Size size_b = other.size_limbs();
+
+            Word* a = _reg.data();
+
+            Word borrow = sub_n(a, a, other._reg.data(), size_b);
+
+            sub_1(a + size_b, a + size_b, size_a - size_b, borrow);
+
+            trim();
+
+            return *this;
+        }
+
+        Whole_Number& Whole_Number::operator*=(const Whole_Number& other) {
+
+            *this = *this * other;
+
+            return *this;
+        }
+
+        Whole_Number& Whole_Number::operator/=(const Whole_Number& other) {
+
+            *this = *this / other;
+
+            return *this;
+        }
+
+        Whole_Number& Whole_Number::operator%=(const Whole_Number& other) {
+
+            *this = *this % other;
+
+            return *this;
+        }
+
+        Whole_Number& Whole_Number::operator+=(Word other) {
+
+            APM_COUNT(add);
+
+            Size size = size_limbs();
+
+            Word* a = _reg.data();
+
+            Word carry = add_1(a, a, size, other);
+
+            if (carry != 0) {
+
+                _reg.at_reg(size) = carry;
+            }
+
+            trim();
+
+            return *this;
+        }
+
+        Whole_Number& Whole_Number::operator-=(Word other) {
+
+            APM_COUNT(sub);
+
+            if (compare(other) < 0) {
+                *this = Whole_Number();
+                return *this;
+            }
+
+            Size size = size_limbs();
+
+            Word* a = _reg.data();
+
+            sub_1(a, a, size, other);
+
+            trim();
+
+            return *this;
+        }
+
+        Whole_Number& Whole_Number::operator*=(Word other) {
+
+            APM_COUNT(mul_basecase);
+
+            Size size = size_limbs();
+
+            Word* a = _reg.data();
+
+            Word carry = mul_1(a, a, size, other);
+
+            if (carry != 0) {
+
+                _reg.at_reg(size) = carry;
+            }
+
+            trim();
+
+            return *this;
+        }
+
+        Whole_Number& Whole_Number::operator/=(Word other) {
+
+            APM_COUNT(div);
+
+            if (other == 0) {
+                // Division by zero.
+                *this = Whole_Number();
+                return *this;
+            }
+
+            Size size = size_limbs();
+
+            Word* a = _reg.data();
+
+            divrem_1(a, a, size, other);
+
+            trim();
+
+            return *this;
+        }
+
+        Whole_Number& Whole_Number::operator%=(Word other) {
+
+            APM_COUNT(div);
+
+            if (other == 0) {
+                // Division by zero.
+                *this = Whole_Number();
+                return *this;
+            }
+
+            /*  Only the remainder is kept, so the quotient words are
+                divided out without being stored.  */
+
+            const Word* a = std::as_const(_reg).data();
+
+            Word r = 0;
+
+            for (Size i = size_limbs(); i-- > 0;) {
+                div_wide(r, a[i], other, r);
+            }
+
+            _reg = Reg(1, r);
+
+            return *this;
+        }
+
+        Whole_Number Whole_Number::operator+(const Whole_Number& b) const {
+
+            Whole_Number a = *this;
+
+            a += b;
+
+            return a;
+        }
+
+        Whole_Number Whole_Number::operator-(const Whole_Number& b) const {
+
+            Whole_Number a = *this;
+
+            a -= b;
+
+            return a;
+        }
+
+        Whole_Number Whole_Number::operator*(const Whole_Number& b) const {
+
+            Size size_a = size_limbs();
+            Size size_b = b.size_limbs();
+
+            if (std::min(size_a, size_b) >= PARALLEL_MUL_LIMBS && Thread_Pool::shared().size() > 1 && !Thread_Pool::is_worker()) {
+
+                APM_COUNT(mul_parallel);
+
+                return parallel_mul(b);
+            }
+
+            if (std::min(size_a, size_b) < KARATSUBA_THRESHOLD) {
+                APM_COUNT(mul_basecase);
+            }
+            else {
+                APM_COUNT(mul_karatsuba);
+            }
+
+            Reg r((size_a + size_b), 0);
+
+            if (size_a >= size_b) {
+                mul(r.data(), _reg.data(), size_a, b._reg.data(), size_b);
+            }
+            else {
+                mul(r.data(), b._reg.data(), size_b, _reg.data(), size_a);
+            }
+
+            r.trim();
+
+            return r;
+        }
+
+        Whole_Number Whole_Number::operator/(const Whole_Number& b) const {
+
+            Whole_Number q;
+            Whole_Number r;
+
+            div_rem(b, q, r);
+
+            return q;
+        }
+
+        Whole_Number Whole_Number::operator%(const Whole_Number& b) const {
+
+            Whole_Number q;
+            Whole_Number r;
+
+            div_rem(b, q, r);
+
+            return r;
+        }
+
+        Whole_Number& Whole_Number::operator++() {
+            return operator+=(Word(1));
+        }
+
+        Whole_Number Whole_Number::operator++(int) {
+
+            Whole_Number a(*this);
+
+            operator++();
+
+            return a;
+        }
+
+        Whole_Number& Whole_Number::operator--() {
+            return operator-=(Word(1));
+        }
+
+        Whole_Number Whole_Number::operator--(int) {
+
+            Whole_Number a(*this);
+
+            operator--();
+
+            return a;
+        }
+
+        void Whole_Number::div_rem(const Whole_Number& other, Whole_Number& qot, Whole_Number& rem) const {
+
+            APM_COUNT(div);
+
+            if (!other.is()) {
+                // Division by zero.
+                qot = Whole_Number();
+                rem = Whole_Number();
+                return;
+            }
+
+            if (other > *this) {
+                // Division by a greater value.
+                rem = *this;
+                qot = Whole_Number();
+                return;
+            }
+
+            Size size_a = size_limbs();
+            Size size_b = other.size_limbs();
+
+            // Build into locals, since 'qot' or 'rem' may alias an operand.
+            Reg q(size_a - size_b + 1, 0);
+            Reg r(size_b, 0);
+
+            if (size_b == 1) {
+                r.at_reg(0) = divrem_1(q.data(), _reg.data(), size_a, other._reg.at_reg(0));
+            }
+            else {
+                div_qr(q.data(), r.data(), _reg.data(), size_a, other._reg.data(), size_b);
+            }
+
+            qot._reg = std::move(q.trim());
+            rem._reg = std::move(r.trim());
+        }
+
+        Whole_Number Whole_Number::pow(Size b) const {
+
+            if (b == 2) {
+                Whole_Number a = *this;
+                return a * a;
+            }
+
+            if (b == 1) {
+                return *this;
+            }
+            
+            if (b == 0) {
+                return 1;
+            }
+
+            Whole_Number a = *this;
+            Whole_Number res = 1;
+
+            while (b) {
+
+                if (b & 1) {
+
+                    res *= a;
+                }
+
+                b >>= 1;
+
+                if (b) {
+                    a *= a;
+                }
+            }
+
+            return res;
+        }
+
+        Whole_Number Whole_Number::sqrt() const {
+            return newton_root(2);
+        }
+
+        Whole_Number Whole_Number::root(const Whole_Number& b) const {
+
+            Size n = b.to_integral<Size>();
+
+            if (n < 2) {
+                return *this;
+            }
+
+            return newton_root(n);
+        }
+
+        Text Whole_Number::to_string() const {
+            return to_string(10);
+        }
+
+        Text Whole_Number::to_string(Size base) const {
+
+            APM_COUNT(to_string);
+
+            if (base == 10 || base == 0 || base == 2 || base == 8 || base == 16) {
+
+                if (!is()) {
+                    return "0";
+                }
+
+                Word radix = static_cast<Word>(base != 0 ? base : 10);
+
+                Size digits;
+                Word chunk = radix_chunk(radix, digits);
+
+                // Climb the ladder until its top exceeds the number, which then fills
+                // exactly 'digits' * 2^level places, the leading ones zero.
+                std::vector<Whole_Number> ladder = Power_Cache::ladder(chunk, *this);
+
+                Size level = ladder.size() - 1;
+
+                Text digit_text(digits << level, '0');
+
+                radix_split(digit_text.data(), digit_text.size(), radix, digits, ladder, level);
+
+                Size lead = digit_text.find_first_not_of('0');
+
+                Size count = digit_text.size() - lead;
+
+                Text res;
+
+                if (base == 10) {
+                    // Group the digits in threes, written straight into place.
+                    res.assign(count + (count - 1) / 3, ',');
+
+                    for (Size i = 0, j = res.size(); i < count; ++i) {
+
+                        if (i > 0 && i % 3 == 0) {
+                            j -= 1;
+                        }
+
+                        res[--j] = digit_text[digit_text.size() - 1 - i];
+                    }
+                }
+                else {
+                    res.assign(digit_text, lead, count);
+                }
+
+                switch (base) {
+
+                case (2):
+                    res = "0b" + res;
+                    break;
+
+                case (8):
+                    res = "0o" + res;
+                    break;
+
+                case (16):
+                    res = "0x" + res;
+                    break;
+                }
+
+                return res;
+            }
+
+            return "";
+        }
+
+        /********************************************************************************************/
+        //
+        //                              'Radix_Reader' Class Definition
+        //
+        //        Joins digits as they arrive.  Each block of BLOCK digits joins by halves, and
+        //        blocks of like length pair off into one of twice the length, the way a binary
+        //        counter carries.  So only one block of digit values is held at any time.
+        //
+        /********************************************************************************************/
+
+        class Whole_Number::Radix_Reader {
+
+        public:
+
+            Radix_Reader(Word radix) : _radix(radix), _digits(0), _ladder(), _values(), _blocks(), _count(0) {
+
+                radix_chunk(radix, _digits);
+
+                _values.reserve(_digits << BLOCK_LEVEL);
+            }
+
+            Boolean push(Char c) {
+                // Take a character, or report it ends the number.
+
+                Word x = _radix;
+
+                if (c >= '0' && c <= '9') {
+                    x = static_cast<Word>(c - '0');
+                }
+                else if (c >= 'a' && c <= 'f') {
+                    x = static_cast<Word>(c - 'a' + 10);
+                }
+                else if (c >= 'A' && c <= 'F') {
+                    x = static_cast<Word>(c - 'A' + 10);
+                }
+                else if (c == ',' && _radix == 10 && _count > 0) {
+                    return true;
+                }
+
+                if (x >= _radix) {
+                    return false;
+                }
+
+                _values.push_back(static_cast<Char>(x));
+                _count += 1;
+
+                if (_values.size() == (_digits << BLOCK_LEVEL)) {
+                    push_block();
+                }
+
+                return true;
+            }
+
+            Size count() const {
+                return _count;
+            }
+
+            Whole_Number finish() {
+
+                Size rest = _values.size();
+
+                grow(BLOCK_LEVEL);
+
+                Whole_Number tail = radix_join(_values.data(), rest, _radix, _digits, _ladder, BLOCK_LEVEL);
+
+                if (_blocks.empty()) {
+                    return tail;
+                }
+
+                // The blocks fall in length from the leading digits.
+                Whole_Number n = std::move(_blocks[0].first);
+
+                for (Size i = 1; i < _blocks.size(); ++i) {
+
+                    grow(BLOCK_LEVEL + _blocks[i].second + 1);
+
+                    n = n * _ladder[BLOCK_LEVEL + _blocks[i].second] + _blocks[i].first;
+                }
+
+                return n * Power_Cache::power(_radix, rest) + tail;
+            }
+
+        private:
+
+            static const Size BLOCK_LEVEL = 8;      // Blocks of digits * 2^8 digits.
+
+            Word _radix;
+            Size _digits;
+
+            std::vector<Whole_Number>                    _ladder;
+            Text                                         _values;
+            std::vector<std::pair<Whole_Number, Size>>   _blocks;   // Each joined block and its level.
+            Size                                         _count;
+
+            void grow(Size levels) {
+
+                if (_ladder.size() < levels) {
+                    _ladder = Power_Cache::ladder(radix_chunk(_radix, _digits), levels);
+                }
+            }
+
+            void push_block() {
+
+                grow(BLOCK_LEVEL);
+
+                Whole_Number block = radix_join(_values.data(), _values.size(), _radix, _digits, _ladder, BLOCK_LEVEL);
+
+                _values.clear();
+
+                Size level = 0;
+
+                while (!_blocks.empty() && _blocks.back().second == level) {
+
+                    grow(BLOCK_LEVEL + level + 1);
+
+                    block = _blocks.back().first * _ladder[BLOCK_LEVEL + level] + block;
+
+                    _blocks.pop_back();
+
+                    level += 1;
+                }
+
+                _blocks.emplace_back(std::move(block), level);
+            }
+        };
+
+        void Whole_Number::write_digits(std::ostream& out, Size base) const {
+            write_digits([&out](const Char* text, Size length) { out.write(text, length); }, base);
+        }
+
+        void Whole_Number::write_digits(FILE* file, Size base) const {
+            write_digits([file](const Char* text, Size length) { std::fwrite(text, 1, length, file); }, base);
+        }
+
+        Whole_Number Whole_Number::read_digits(std::istream& in, Size base) {
+
+            Size count;
+
+            return read_digits(in, base, count);
+        }
+
+        Whole_Number Whole_Number::read_digits(std::istream& in, Size base, Size& count) {
+            /*
+                Skip leading white space, then take digits of the base until a
+                character which is not one, leaving that character in the stream.
+                A base 10 number may group its digits with commas.  When no digit
+                is found the stream's fail bit is set.
+            */
+
+            APM_COUNT(parse);
+
+            Radix_Reader reader(static_cast<Word>((base == 2 || base == 8 || base == 16) ? base : 10));
+
+            std::istream::sentry ready(in);
+
+            if (ready) {
+
+                std::streambuf* buffer = in.rdbuf();
+
+                auto c = buffer->sgetc();
+
+                while (c != std::char_traits<Char>::eof() && reader.push(std::char_traits<Char>::to_char_type(c))) {
+                    c = buffer->snextc();
+                }
+
+                if (c == std::char_traits<Char>::eof()) {
+                    in.setstate(std::ios_base::eofbit);
+                }
+            }
+
+            count = reader.count();
+
+            if (count == 0) {
+                in.setstate(std::ios_base::failbit);
+            }
+
+            return reader.finish();
+        }
+
+        const Whole_Number::Reg& Whole_Number::get_Binary_Register() const {
+            return _reg;
+        }
+
+        Boolean Whole_Number::set_numeric_value(const Text& text, const Word& base) {
+            /*
+                Gather the value of each digit, then join them into the number by
+                halves.  A malformed digit leaves the number zero and reports an error.
+            */
+
+            APM_COUNT(parse);
+
+            if (base != 2 && base != 8 && base != 10 && base != 16) {
+                return false;
+            }
+
+            Text values;
+
+            values.reserve(text.size());
+
+            for (const auto n : text) {
+
+                Word x = base;
+
+                if (base == 2) {
+                    // Every character of a binary number must be a digit.
+                    x = (n == '0' || n == '1') ? static_cast<Word>(n - '0') : base;
+                }
+                else if (std::isspace(n) || (base == 10 && n == ',')) {
+                    continue;
+                }
+                else if (n >= '0' && n <= '9') {
+                    x = static_cast<Word>(n - '0');
+                }
+                else if (base == 16 && n >= 'a' && n <= 'f') {
+                    x = static_cast<Word>(n - 'a' + 10);
+                }
+                else if (base == 16 && n >= 'A' && n <= 'F') {
+                    x = static_cast<Word>(n - 'A' + 10);
+                }
+
+                if (x >= base) {
+                    _reg = Reg();
+                    return true;
+                }
+
+                values.push_back(static_cast<Char>(x));
+            }
+
+            Size digits;
+            Word chunk = radix_chunk(base, digits);
+
+            Size level = 0;
+
+            while ((digits << level) < values.size()) {
+                level += 1;
+            }
+
+            *this = radix_join(values.data(), values.size(), base, digits, Power_Cache::ladder(chunk, level), level);
+
+            return false;
+        }
+
+        Whole_Number::Word Whole_Number::radix_chunk(Word radix, Size& digits) {
+
+            Word chunk = radix;
+
+            digits = 1;
+
+            while (chunk <= Reg::MASK / radix) {
+                chunk  *= radix;
+                digits += 1;
+            }
+
+            return chunk;
+        }
+
+        void Whole_Number::radix_split(Char* out, Size width, Word radix, Size digits,
+                                       const std::vector<Whole_Number>& ladder, Size level) const {
+            /*
+                Write the number, less than ladder[level], as exactly 'width' digits into
+                'out', which is already filled with zeros.  The quotient and remainder by
+                ladder[level - 1] are the two halves of the digits, each converted on its
+                own, so the halves of a large number run on the pool at once.  A small
+                number is divided a word of digits at a time.
+            */
+
+            static const Char DIGITS[] = "0123456789abcdef";
+
+            Size size = size_limbs();
+
+            if (level == 0 || size <= RADIX_SPLIT_LIMBS) {
+
+                Word chunk = ladder[0].to_integral<Word>();
+
+                Size shift   = lead_zeros(chunk);                // Every division is by the chunk, so
+                Word divisor = chunk << shift;                   // by its reciprocal.
+                Word inverse = reciprocal_word(divisor);
+
+                Limb_Vector<Word> n(_reg.data(), _reg.data() + size);
+
+                while (size && n[size - 1] == 0) {
+                    size -= 1;
+                }
+
+                for (Size pos = width; size > 0;) {
+
+                    Word r = divrem_1_preinv(n.data(), n.data(), size, divisor, shift, inverse);
+
+                    while (size && n[size - 1] == 0) {
+                        size -= 1;
+                    }
+
+                    for (Size i = 0; i < digits && pos > 0; i += 1) {
+
+                        out[--pos] = DIGITS[r % radix];
+
+                        r /= radix;
+                    }
+                }
+
+                return;
+            }
+
+            Whole_Number halves[2];
+
+            div_rem(ladder[level - 1], halves[0], halves[1]);
+
+            const Size half = width / 2;
+
+            auto split = [&](Size begin, Size end) {
+
+                for (Size i = begin; i < end; ++i) {
+                    halves[i].radix_split(out + i * half, half, radix, digits, ladder, level - 1);
+                }
+            };
+
+            if (size >= PARALLEL_RADIX_LIMBS) {
+                Thread_Pool::shared().parallel_for(2, 1, split);
+            }
+            else {
+                split(0, 2);
+            }
+        }
+
+        Whole_Number Whole_Number::radix_join(const Char* values, Size length, Word radix, Size digits,
+                                              const std::vector<Whole_Number>& ladder, Size level) {
+            /*
+                The number written by 'length' digit values.  The low digits_per_word * 2^(level - 1)
+                digits and the digits above them join on their own, the halves of a long
+                text on the pool at once, and then high * ladder[level - 1] + low.  A short
+                text is read a word of digits at a time.
+            */
+
+            while (level > 0 && (digits << (level - 1)) >= length) {
+                level -= 1;
+            }
+
+            if (level == 0 || length <= digits * RADIX_SPLIT_LIMBS) {
+
+                Limb_Vector<Word> n;
+
+                for (Size i = 0; i < length;) {
+
+                    Size group = (i == 0 && length % digits) ? length % digits : digits;
+
+                    Word scale = 1;
+                    Word value = 0;
+
+                    for (Size end = i + group; i < end; ++i) {
+                        scale *= radix;
+                        value  = value * radix + static_cast<Word>(values[i]);
+                    }
+
+                    Word carry = mul_1(n.data(), n.data(), n.size(), scale);
+
+                    if (carry) {
+                        n.push_back(carry);
+                    }
+
+                    carry = add_1(n.data(), n.data(), n.size(), value);
+
+                    if (carry) {
+                        n.push_back(carry);
+                    }
+                }
+
+                Reg r(n.size(), 0);
+
+                for (Size i = 0; i < n.size(); ++i) {
+                    r.at_reg(i) = n[i];
+                }
+
+                return r;
+            }
+
+            const Size low = digits << (level - 1);
+
+            Whole_Number halves[2];
+
+            auto join = [&](Size begin, Size end) {
+
+                for (Size i = begin; i < end; ++i) {
+
+                    halves[i] = (i == 0)
+                        ? radix_join(values, length - low, radix, digits, ladder, level - 1)
+                        : radix_join(values + length - low, low, radix, digits, ladder, level - 1);
+                }
+            };
+
+            if (length >= digits * PARALLEL_RADIX_LIMBS) {
+                Thread_Pool::shared().parallel_for(2, 1, join);
+            }
+            else {
+                join(0, 2);
+            }
+
+            return halves[0] * ladder[level - 1] + halves[1];
+        }
+
+        void Whole_Number::write_digits(const Digit_Sink& sink, Size base) const {
+            /*
+                Walk the same halves as 'to_string', but in order from the leading
+                digits, passing each piece on through a bounded buffer.  Only the
+                quotients and remainders along one path of the halving are held.
+            */
+
+            APM_COUNT(to_string);
+
+            Word radix = static_cast<Word>((base == 2 || base == 8 || base == 16) ? base : 10);
+
+            Size digits;
+            Word chunk = radix_chunk(radix, digits);
+
+            std::vector<Whole_Number> ladder = Power_Cache::ladder(chunk, *this);
+
+            Text buffer;
+
+            buffer.reserve(WRITE_CHUNK);
+
+            auto flush = [&]() {
+
+                if (!buffer.empty()) {
+                    sink(buffer.data(), buffer.size());
+                    buffer.clear();
+                }
+            };
+
+            Digit_Sink buffered = [&](const Char* text, Size length) {
+
+                if (buffer.size() + length > WRITE_CHUNK) {
+                    flush();
+                }
+
+                if (length >= WRITE_CHUNK) {
+                    sink(text, length);
+                }
+                else {
+                    buffer.append(text, length);
+                }
+            };
+
+            Boolean lead = true;
+
+            radix_emit(buffered, radix, digits, ladder, ladder.size() - 1, lead);
+
+            if (lead) {
+                buffered("0", 1);
+            }
+
+            flush();
+        }
+
+        void Whole_Number::radix_emit(const Digit_Sink& sink, Word radix, Size digits,
+                                      const std::vector<Whole_Number>& ladder, Size level, Boolean& lead) const {
+            /*
+                Pass on the number, less than ladder[level], as exactly digits * 2^level
+                digits.  Until the first non zero digit is passed on, 'lead' is set and
+                the leading zeros are dropped.
+            */
+
+            static const Char DIGITS[] = "0123456789abcdef";
+            static const Text ZEROS(256, '0');
+
+            Size size = size_limbs();
+
+            if (level == 0 || size <= RADIX_SPLIT_LIMBS) {
+
+                Word chunk = ladder[0].to_integral<Word>();
+
+                Size shift   = lead_zeros(chunk);                // Every division is by the chunk, so
+                Word divisor = chunk << shift;                   // by its reciprocal.
+                Word inverse = reciprocal_word(divisor);
+
+                Limb_Vector<Word> n(_reg.data(), _reg.data() + size);
+                std::vector<Char> text(size * Limb_Traits<Word>::BITS);     // No more digits than bits.
+
+                Size pos = text.size();
+
+                while (size && n[size - 1] == 0) {
+                    size -= 1;
+                }
+
+                while (size > 0) {
+
+                    Word r = divrem_1_preinv(n.data(), n.data(), size, divisor, shift, inverse);
+
+                    while (size && n[size - 1] == 0) {
+                        size -= 1;
+                    }
+
+                    for (Size i = 0; i < digits && (size || r); i += 1) {
+
+                        text[--pos] = DIGITS[r % radix];
+
+                        r /= radix;
+                    }
+                }
+
+                Size length = text.size() - pos;
+
+                if (lead) {
+
+                    lead = length == 0;
+                }
+                else {
+
+                    for (Size zeros = (digits << level) - length; zeros > 0;) {
+
+                        Size piece = (zeros < ZEROS.size()) ? zeros : ZEROS.size();
+
+                        sink(ZEROS.data(), piece);
+
+                        zeros -= piece;
+                    }
+                }
+
+                sink(text.data() + pos, length);
+
+                return;
+            }
+
+            Whole_Number halves[2];
+
+            div_rem(ladder[level - 1], halves[0], halves[1]);
+
+            halves[0].radix_emit(sink, radix, digits, ladder, level - 1, lead);
+            halves[0] = Whole_Number();
+
+            halves[1].radix_emit(sink, radix, digits, ladder, level - 1, lead);
+        }
+
+        void Whole_Number::trim() {
+            _reg.trim();
+        }
+
+        Whole_Number Whole_Number::newton_root(Size n) const {
+            /*
+                The floor of the nth root by Newton's iteration.  The root of the leading
+                half of the bits, shifted into place, holds about half the bits of the
+                root.  A Newton step from it doubles that, so each level of the recursion
+                works at only the size it needs, and the last level is a single division.
+            */
+
+            if (!is()) {
+                return Whole_Number();
+            }
+
+            Size bits = _reg.lead_bit();
+
+            Whole_Number x;
+
+            if (bits <= 4 * n * Limb_Traits<Word>::BITS) {
+                // Start from a power of two past the root.
+                x = Whole_Number(1) << ((bits + n - 1) / n);
+            }
+            else {
+                Size k = bits / (2 * n);
+
+                x = (*this >> (n * k)).newton_root(n) << k;
+
+                // From any start, one step lands on or past the root.
+                Whole_Number t = *this / x.pow(n - 1);
+
+                x *= n - 1;
+                x += t;
+                x /= n;
+            }
+
+            // Newton's iteration from above, until it stops falling.
+            while (true) {
+
+                Whole_Number y = x;
+
+                y *= n - 1;
+                y += *this / x.pow(n - 1);
+                y /= n;
+
+                if (y >= x) {
+                    return x;
+                }
+
+                x = std::move(y);
+            }
+        }
+
+        Whole_Number Whole_Number::parallel_mul(const Whole_Number& b) const {
+            /*
+                Run the products at the top of a large multiplication on the shared pool.
+                Operands of like length take one step of Karatsuba's method, and run its
+                three products at once.  A longer operand is cut into pieces at least as
+                long as the other, and the pieces are multiplied at once.  The products
+                themselves may split again from the calling thread.  Every product is
+                exact, so the result does not depend on the thread count.
+            */
+
+            Thread_Pool& pool = Thread_Pool::shared();
+
+            const Whole_Number& x = (size_limbs() >= b.size_limbs()) ? *this : b;
+            const Whole_Number& y = (size_limbs() >= b.size_limbs()) ? b : *this;
+
+            const Size size_x = x.size_limbs();
+            const Size size_y = y.size_limbs();
+            const Size bits   = Limb_Traits<Word>::BITS;
+
+            if (size_x >= 2 * size_y) {
+
+                const Size pieces = std::min(pool.size(), size_x / size_y);
+
+                std::vector<Whole_Number> products(pieces);
+
+                pool.parallel_for(pieces, 1, [&](Size begin, Size end) {
+
+                    for (Size i = begin; i < end; ++i) {
+                        products[i] = x.limbs(size_x * i / pieces, size_x * (i + 1) / pieces) * y;
+                    }
+                });
+
+                Whole_Number r;
+
+                for (Size i = 0; i < pieces; ++i) {
+                    r += products[i] << (size_x * i / pieces * bits);
+                }
+
+                return r;
+            }
+
+            const Size half = size_y / 2;
+
+            const Whole_Number x_0 = x.limbs(0, half), x_1 = x.limbs(half, size_x);
+            const Whole_Number y_0 = y.limbs(0, half), y_1 = y.limbs(half, size_y);
+
+            const Whole_Number* factors[3][2] = {
+                { &x_0, &y_0 }, { &x_1, &y_1 }, { nullptr, nullptr }
+            };
+
+            const Whole_Number x_sum = x_0 + x_1;
+            const Whole_Number y_sum = y_0 + y_1;
+
+            factors[2][0] = &x_sum;
+            factors[2][1] = &y_sum;
+
+            Whole_Number products[3];
+
+            pool.parallel_for(3, 1, [&](Size begin, Size end) {
+
+                for (Size i = begin; i < end; ++i) {
+                    products[i] = *factors[i][0] * *factors[i][1];
+                }
+            });
+
+            Whole_Number middle = products[2] - products[0] - products[1];
+
+            return (products[1] << (2 * half * bits)) + (middle << (half * bits)) + products[0];
+        }
+
+        Whole_Number Whole_Number::limbs(Size begin, Size end) const {
+
+            Reg r(end - begin, 0);
+
+            for (Size i = begin; i < end; ++i) {
+                r.at_reg(i - begin) = _reg.at_reg(i);
+            }
+
+            r.trim();
+
+            return r;
+        }
+
+        Size Whole_Number::size_limbs() const {
+
+            Size size = _reg.size_regs();
+
+            while (size > 1 && _reg.at_reg(size - 1) == 0) {
+                size -= 1;
+            }
+
+            return size;
+        }
+    }
+}
@@ -1,138 +1,196 @@
-#pragma once
-
-/*********************************************************************/
-//
-//			Copyright 2022 Max J. Martin
-//
-//			This file is part of APM.
-// 
-//			APM is free software : you can redistribute it
-//			and /or modify it under the terms of the GNU General
-//			Public License as published by the Free Software
-//			Foundation, either version 3 of the License, or
-//			(at your option) any later version.
-//			
-//			APM is distributed in the hope that it will be
-//			useful, but WITHOUT ANY WARRANTY; without even the
-//			implied warranty of MERCHANTABILITY or FITNESS FOR
-//			A PARTICULAR PURPOSE.See the GNU General Public
-//			
-//			You should have received a copy of the GNU General
-//			Public License along with APM.If not, see
-//			< https://www.gnu.org/licenses/>.
-//			
-/*********************************************************************/
-
-#include "../Binary_Register.h"
-
-namespace Olly {
-    namespace APM {
-
-        /********************************************************************************************/
-        //
-        //                              'Whole_Number' Class Declaration
-        //
-        /********************************************************************************************/
-
-        class Whole_Number {
-
-        public:
-            typedef sys_uint              Word;
-            typedef sys_ulong             Double_Word;
-            typedef Binary_Register<Word> Reg;
-
-            Whole_Number();
-            Whole_Number(Word value);
-            Whole_Number(const Text& value, Word base = 10);
-            Whole_Number(const Text& value, Word base, Boolean& error);
-            virtual ~Whole_Number();
-
-            Whole_Number(Whole_Number&& obj)                 = default;
-            Whole_Number(const Whole_Number& obj)            = default;
-            Whole_Number& operator=(const Whole_Number& obj) = default;
-            Whole_Number& operator=(Whole_Number&& obj)      = default;
-
-            Boolean is() const;
-
-            Boolean is_odd()  const;
-            Boolean is_even() const;
-
-            Boolean operator==(const Whole_Number& b) const;
-            Boolean operator!=(const Whole_Number& b) const;
-            Boolean operator< (const Whole_Number& b) const;
-            Boolean operator> (const Whole_Number& b) const;
-            Boolean operator<=(const Whole_Number& b) const;
-            Boolean operator>=(const Whole_Number& b) const;
-
-            sys_float compare(const Whole_Number& other) const;
-
-            Whole_Number& operator&=(const Whole_Number& other);
-            Whole_Number& operator|=(const Whole_Number& other);
-            Whole_Number& operator^=(const Whole_Number& other);
-
-            Whole_Number& operator<<=(Size index);
-            Whole_Number& operator>>=(Size index);
-
-            Whole_Number bin_comp() const;
-
-            Whole_Number operator&(const Whole_Number& b) const;
-            Whole_Number operator|(const Whole_Number& b) const;
-            Whole_Number operator^(const Whole_Number& b) const;
-            Whole_Number operator~() const;
-
-            Whole_Number operator<<(Size index) const;
-            Whole_Number operator>>(Size index) const;
-
-            Whole_Number& operator+=(const Whole_Number& other);
-            Whole_Number& operator-=(const Whole_Number& other);
-            Whole_Number& operator*=(const Whole_Number& other);
-            Whole_Number& operator/=(const Whole_Number& other);
-            Whole_Number& operator%=(const Whole_Number& other);
-
-            Whole_Number operator+(const Whole_Number& b) const;
-            Whole_Number operator-(const Whole_Number& b) const;
-            Whole_Number operator*(const Whole_Number& b) const;
-            Whole_Number operator/(const Whole_Number& b) const;
-            Whole_Number operator%(const Whole_Number& b) const;
-
-            Whole_Number& operator++();
-            Whole_Number  operator++(int);
-
-            Whole_Number& operator--();
-            Whole_Number  operator--(int);
-
-            void div_rem(const Whole_Number& other, Whole_Number& qot, Whole_Number& rem) const;
-
-            Whole_Number pow(Size b) const;
-
-            Whole_Number sqrt() const;
-            Whole_Number  root(const Whole_Number& b) const;
-
-            Text to_string()			   const;
-            Text to_string(Size base) const;
-
-            template<typename N>
-            N to_integral() const;
-
-            const Reg& get_Binary_Register() const;
-
-        private:
-
-            Reg _reg;
-
-            Whole_Number(const Reg& reg);
-
-            void trim();
-
-            void divide_remainder(Word d, Whole_Number& q, Whole_Number& r, sys_int stop) const;
-
-            Boolean set_numeric_value(const Text& text, const Word& base);
-        };
-
-        template<typename N>
-        inline N Whole_Number::to_integral() const {
-            return _reg.to_integral<N>();
-        }
-    }
-}
-
+#pragma once
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+// 
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//			
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//			
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//			
+/*********************************************************************/
+
+#include <cstdio>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include "../Binary_Register.h"
+#include "../Limb_Kernels.h"
+
+namespace Olly {
+    namespace APM {
+
+        /********************************************************************************************/
+        //
+        //                              'Whole_Number' Class Declaration
+        //
+        /********************************************************************************************/
+
+        class Whole_Number {
+
+        public:
+            typedef sys_limb                     Word;
+            typedef Limb_Traits<Word>::Double    Double_Word;
+            typedef Binary_Register<Word>        Reg;
+
+            Whole_Number();
+            Whole_Number(Word value);
+            Whole_Number(const Text& value, Word base = 10);
+            Whole_Number(const Text& value, Word base, Boolean& error);
+            virtual ~Whole_Number();
+
+            Whole_Number(Whole_Number&& obj)                 = default;
+            Whole_Number(const Whole_Number& obj)            = default;
+            Whole_Number& operator=(const Whole_Number& obj) = default;
+            Whole_Number& operator=(Whole_Number&& obj)      = default;
+
+            Boolean is() const;
+
+            Boolean is_odd()  const;
+            Boolean is_even() const;
+
+            Boolean operator==(const Whole_Number& b) const;
+            Boolean operator!=(const Whole_Number& b) const;
+            Boolean operator< (const Whole_Number& b) const;
+            Boolean operator> (const Whole_Number& b) const;
+            Boolean operator<=(const Whole_Number& b) const;
+            Boolean operator>=(const Whole_Number& b) const;
+
+            Boolean operator==(Word b) const;
+            Boolean operator!=(Word b) const;
+            Boolean operator< (Word b) const;
+            Boolean operator> (Word b) const;
+            Boolean operator<=(Word b) const;
+            Boolean operator>=(Word b) const;
+
+            sys_float compare(const Whole_Number& other) const;
+            sys_float compare(Word other)                const;
+
+            Whole_Number& operator&=(const Whole_Number& other);
+            Whole_Number& operator|=(const Whole_Number& other);
+            Whole_Number& operator^=(const Whole_Number& other);
+
+            Whole_Number& operator<<=(Size index);
+            Whole_Number& operator>>=(Size index);
+
+            Whole_Number bin_comp() const;
+
+            Whole_Number operator&(const Whole_Number& b) const;
+            Whole_Number operator|(const Whole_Number& b) const;
+            Whole_Number operator^(const Whole_Number& b) const;
+            Whole_Number operator~() const;
+
+            Whole_Number operator<<(Size index) const;
+            Whole_Number operator>>(Size index) const;
+
+            Whole_Number& operator+=(const Whole_Number& other);
+            Whole_Number& operator-=(const Whole_Number& other);
+            Whole_Number& operator*=(const Whole_Number& other);
+            Whole_Number& operator/=(const Whole_Number& other);
+            Whole_Number& operator%=(const Whole_Number& other);
+
+            Whole_Number& operator+=(Word other);    // A single word operand, applied in place
+            Whole_Number& operator-=(Word other);    // by the one limb kernels.
+            Whole_Number& operator*=(Word other);
+            Whole_Number& operator/=(Word other);
+            Whole_Number& operator%=(Word other);
+
+            Whole_Number operator+(const Whole_Number& b) const;
+            Whole_Number operator-(const Whole_Number& b) const;
+            Whole_Number operator*(const Whole_Number& b) const;
+            Whole_Number operator/(const Whole_Number& b) const;
+            Whole_Number operator%(const Whole_Number& b) const;
+
+            Whole_Number& operator++();
+            Whole_Number  operator++(int);
+
+            Whole_Number& operator--();
+            Whole_Number  operator--(int);
+
+            void div_rem(const Whole_Number& other, Whole_Number& qot, Whole_Number& rem) const;
+
+            Whole_Number pow(Size b) const;
+
+            Whole_Number sqrt() const;
+            Whole_Number  root(const Whole_Number& b) const;
+
+            Text to_string()			   const;
+            Text to_string(Size base) const;
+
+            typedef std::function<void(const Char*, Size)> Digit_Sink;
+
+            void write_digits(std::ostream& out,       Size base = 10) const;  // The bare digits, streamed in bounded
+            void write_digits(FILE* file,              Size base = 10) const;  // pieces rather than built as text.
+            void write_digits(const Digit_Sink& sink,  Size base = 10) const;
+
+            static Whole_Number read_digits(std::istream& in, Size base = 10);
+            static Whole_Number read_digits(std::istream& in, Size base, Size& count);  // Also counts the digits read.
+
+            template<typename N>
+            N to_integral() const;
+
+            const Reg& get_Binary_Register() const;
+
+        private:
+
+            friend class Binary_Format;             // The encodings of 'Binary_Format.h'.
+            friend class Number_View;
+            friend class Number_Literal;            // The literals of 'Literals.h'.
+            friend class Divisor;                   // The reciprocal division of 'Divisor.h'.
+            friend class Power_Cache;               // The shared powers of 'Power_Cache.h'.
+
+            Reg _reg;
+
+            Whole_Number(const Reg& reg);
+
+            void trim();
+
+            Size size_limbs() const;
+
+            static const Size PARALLEL_MUL_LIMBS = 1024;    // The shortest operands multiplied on the thread pool.
+
+            Whole_Number parallel_mul(const Whole_Number& b) const;
+            Whole_Number limbs(Size begin, Size end)       const;  // The number held in limbs [begin, end).
+
+            static const Size RADIX_SPLIT_LIMBS    = 32;    // The longest number converted a word at a time.
+            static const Size PARALLEL_RADIX_LIMBS = 1024;  // The shortest number whose halves convert on the pool.
+
+            static Word         radix_chunk(Word radix, Size& digits);    // The largest power of the radix in a word.
+
+            void                radix_split(Char* out, Size width, Word radix, Size digits,
+                                            const std::vector<Whole_Number>& ladder, Size level) const;
+            static Whole_Number radix_join (const Char* values, Size length, Word radix, Size digits,
+                                            const std::vector<Whole_Number>& ladder, Size level);
+
+            static const Size WRITE_CHUNK = 65536;  // The most characters buffered before a write.
+
+            class Radix_Reader;
+
+            void radix_emit (const Digit_Sink& sink, Word radix, Size digits,
+                             const std::vector<Whole_Number>& ladder, Size level, Boolean& lead) const;
+
+            Whole_Number newton_root(Size n) const;
+
+            Boolean set_numeric_value(const Text& text, const Word& base);
+        };
+
+        template<typename N>
+        inline N Whole_Number::to_integral() const {
+            return _reg.to_integral<N>();
+        }
+    }
+}
+
@@ -0,0 +1,1186 @@
+
+/*********************************************************************/
+//
+//			Copyright 2022 Max J. Martin
+//
+//			This file is part of APM.
+//
+//			APM is free software : you can redistribute it
+//			and /or modify it under the terms of the GNU General
+//			Public License as published by the Free Software
+//			Foundation, either version 3 of the License, or
+//			(at your option) any later version.
+//
+//			APM is distributed in the hope that it will be
+//			useful, but WITHOUT ANY WARRANTY; without even the
+//			implied warranty of MERCHANTABILITY or FITNESS FOR
+//			A PARTICULAR PURPOSE.See the GNU General Public
+//
+//			You should have received a copy of the GNU General
+//			Public License along with APM.If not, see
+//			< https://www.gnu.org/licenses/>.
+//
+/*********************************************************************/
+
+
+/*
+    apm_tests - checks results against values computed exactly elsewhere, and
+    exits with the count of failures, for ctest.
+
+        apm_tests
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "APM.h"
+
+using namespace Olly;
+using namespace Olly::APM;
+
+static int failures = 0;
+
+static void check(Boolean passed, const Text& what) {
+
+    if (!passed) {
+
+        std::cout << "failed: " << what << std::endl;
+
+        failures += 1;
+    }
+}
+
+static std::uint64_t random_state = 0x9E3779B97F4A7C15ull;
+
+static std::uint64_t random_word() {
+    /*
+        A repeatable xorshift sequence, with one word in four all ones or zero,
+        so carries and borrows run through full width limbs.
+    */
+
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+
+    switch (random_state % 8) {
+
+    case 0:
+        return ~0ull;
+
+    case 1:
+        return 0;
+
+    default:
+        return random_state;
+    }
+}
+
+static Whole_Number random_whole(Size words) {
+
+    typedef Whole_Number::Word Word;
+
+    Whole_Number a;
+
+    for (Size i = 0; i < words; ++i) {
+
+        Word w = static_cast<Word>(random_word());
+
+        if (i == 0 && w == 0) {
+            w = 1;                                                              // So a holds all its words.
+        }
+
+        a = (a << (sizeof(Word) * 8)) + Whole_Number(w);
+    }
+
+    return a;
+}
+
+/********************************************************************************************/
+//
+//                              Full Width Limbs
+//
+//        Carries and borrows through words of all ones, and products of them.
+//
+/********************************************************************************************/
+
+static void test_limb_carries() {
+
+    const Whole_Number max_1("18446744073709551615");                          // 2^64 - 1
+    const Whole_Number pow_1("18446744073709551616");                          // 2^64
+    const Whole_Number max_2("340282366920938463463374607431768211455");       // 2^128 - 1
+    const Whole_Number pow_2("340282366920938463463374607431768211456");       // 2^128
+    const Whole_Number max_3("6277101735386680763835789423207666416102355444464034512895");
+
+    check(max_1 + Whole_Number(1) == pow_1, "carry out of 2^64 - 1");
+    check(max_2 + Whole_Number(1) == pow_2, "carry through 2^128 - 1");
+    check(pow_2 - Whole_Number(1) == max_2, "borrow through 2^128");
+    check(max_2 + max_2 == (pow_2 << 1) - Whole_Number(2), "sum of 2^128 - 1 with itself");
+
+    check(max_1 * max_1 == Whole_Number("340282366920938463426481119284349108225"), "(2^64 - 1)^2");
+    check(max_3 * max_1 == Whole_Number("115792089237316195417293883273301227089434195242432897623336781819375385575425"),
+          "(2^192 - 1)(2^64 - 1)");
+
+    check(max_2 / max_1 == Whole_Number("18446744073709551617"), "(2^128 - 1) / (2^64 - 1)");
+    check(!(max_2 % max_1).is(),                                  "(2^128 - 1) % (2^64 - 1)");
+    check(max_3 % pow_1 == max_1,                                 "(2^192 - 1) % 2^64");
+
+    check(Integer(-1) * Integer(max_1) + Integer(pow_1) == Integer(1), "signed sum across 2^64");
+    check((Integer(0) - Integer(pow_2)).to_string() == "-340,282,366,920,938,463,463,374,607,431,768,211,456",
+          "negated 2^128");
+}
+
+/********************************************************************************************/
+//
+//                              Decimal Roots
+//
+/********************************************************************************************/
+
+struct Root_Case {
+    Text    value;
+    sys_int k;
+    sys_int scale;
+    Text    mode;
+    Text    root;       // The root, rounded exactly in the mode.
+};
+
+static const Root_Case ROOT_CASES[] = {
+    { "705388.51436209",             3, 20, "half_even",      "89.01765059859620602009" },
+    { "705388.51436209",             3, 20, "floor",          "89.01765059859620602008" },
+    { "705388.51436209",             3, 20, "ceil",           "89.01765059859620602009" },
+    { "619305.45125090",             5, 20, "half_even",      "14.40061303906569021254" },
+    { "619305.45125090",             5, 20, "toward_zero",    "14.40061303906569021253" },
+    { "619305.45125090",             5, 20, "away_from_zero", "14.40061303906569021254" },
+    { "-2.0",                        3, 20, "floor",          "-1.25992104989487316477" },
+    { "-2.0",                        3, 20, "ceil",           "-1.25992104989487316476" },
+    { "-27.0",                       3, 20, "ceil",           "-3.0" },
+    { "2.0",                        -3, 20, "floor",          "0.79370052598409973737" },
+    { "2.0",                        -3, 20, "ceil",           "0.79370052598409973738" },
+    { "-2.0",                       -5, 20, "floor",          "-0.87055056329612413914" },
+    { "8000000000000000000000000.0", -3,  8, "half_even",      "0.0" },            // A tie, at 0.000000005.
+    { "8000000000000000000000000.0", -3,  8, "half_up",        "0.00000001" },
+    { "8000000000000000000000000.0", -3,  8, "ceil",           "0.00000001" },
+};
+
+static void test_roots() {
+
+    for (const Root_Case& c : ROOT_CASES) {
+
+        Decimal_Context_Guard guard(static_cast<Size>(c.scale));
+
+        Decimal::rounding_mode(c.mode);
+
+        Decimal root = Decimal(c.value).root(Decimal(std::to_string(c.k) + ".0"));
+
+        check(root == Decimal(c.root) && root.get_scale() == static_cast<Size>(c.scale),
+              "root(" + c.value + ", " + std::to_string(c.k) + ") at scale " + std::to_string(c.scale) + ", " + c.mode
+              + ": " + root.to_string() + ", expected " + c.root);
+    }
+}
+
+/********************************************************************************************/
+//
+//                              Decimal Whole Powers
+//
+/********************************************************************************************/
+
+struct Power_Case {
+    Text    value;
+    sys_int n;
+    sys_int scale;
+    Text    mode;
+    Text    power;      // The power, rounded exactly in the mode.
+};
+
+static const Power_Case POWER_CASES[] = {
+    { "1.1",      100, 20, "half_even",   "13780.61233982227018411834" },
+    { "1.1",      100, 20, "floor",       "13780.61233982227018411833" },
+    { "1.1",     -100, 20, "half_even",   "0.00007256571590148200" },
+    { "1.1",     -100, 20, "ceil",        "0.00007256571590148201" },
+    { "-0.3",      -7, 10, "floor",       "-4572.4737082762" },
+    { "-0.3",      -7, 10, "ceil",        "-4572.4737082761" },
+    { "123.456",    9,  8, "half_even",   "6662079557313332402.32912205" },
+    { "0.002",      5, 16, "ceil",        "0.0000000000000320" },
+    { "0.002",      5, 16, "toward_zero", "0.0000000000000320" },
+    { "-1.5",       3,  8, "half_even",   "-3.375" },
+    { "7.0",        0,  8, "half_even",   "1.0" },
+};
+
+static void test_powers() {
+
+    for (const Power_Case& c : POWER_CASES) {
+
+        Decimal_Context_Guard guard(static_cast<Size>(c.scale));
+
+        Decimal::rounding_mode(c.mode);
+
+        Decimal power = Decimal(c.value).pow(Decimal(std::to_string(c.n) + ".0"));
+
+        check(power == Decimal(c.power) && power.get_scale() == static_cast<Size>(c.scale),
+              "pow(" + c.value + ", " + std::to_string(c.n) + ") at scale " + std::to_string(c.scale) + ", " + c.mode
+              + ": " + power.to_string() + ", expected " + c.power);
+    }
+}
+
+/********************************************************************************************/
+//
+//                              Exact Results and Ties
+//
+/********************************************************************************************/
+
+struct Exact_Case {
+    Text    name;
+    Decimal (*evaluate)();
+    sys_int scale;
+    Text    mode;
+    Text    value;      // On a rounding boundary at the scale.
+};
+
+static const Exact_Case EXACT_CASES[] = {
+    { "sin(30)",         []() { return Decimal("30.0").sin(); },                       20, "ceil",        "0.5" },
+    { "sin(30)",         []() { return Decimal("30.0").sin(); },                      200, "ceil",        "0.5" },
+    { "cos(60)",         []() { return Decimal("60.0").cos(); },                       20, "floor",       "0.5" },
+    { "log10(1000)",     []() { return Decimal("1000.0").log10(); },                   20, "ceil",        "3.0" },
+    { "log10(1000)",     []() { return Decimal("1000.0").log10(); },                  200, "toward_zero", "3.0" },
+    { "pow(4, 0.5)",     []() { return Decimal("4.0").pow(Decimal("0.5")); },          20, "ceil",        "2.0" },
+    { "pow(0.25, 4.5)",  []() { return Decimal("0.25").pow(Decimal("4.5")); },          8, "half_even",   "0.00195312" },
+    { "pow(0.25, 4.5)",  []() { return Decimal("0.25").pow(Decimal("4.5")); },          8, "half_up",     "0.00195313" },
+    { "pow(0.25, 4.5)",  []() { return Decimal("0.25").pow(Decimal("4.5")); },          8, "toward_zero", "0.00195312" },
+    { "pow(0.25, 4.5)",  []() { return Decimal("0.25").pow(Decimal("4.5")); },          8, "ceil",        "0.00195313" },
+};
+
+static void test_exact_results() {
+
+    for (const Exact_Case& c : EXACT_CASES) {
+
+        Decimal_Context_Guard guard(static_cast<Size>(c.scale));
+
+        Decimal::rounding_mode(c.mode);
+
+        Decimal value = c.evaluate();
+
+        check(value == Decimal(c.value) && value.get_scale() == static_cast<Size>(c.scale),
+              c.name + " at scale " + std::to_string(c.scale) + ", " + c.mode + ": " + value.to_string() + ", expected " + c.value);
+    }
+}
+
+/********************************************************************************************/
+//
+//                              Decimal Parsing
+//
+/********************************************************************************************/
+
+struct Parse_Case {
+    Text    text;
+    sys_int scale;
+    Text    mode;
+    Text    value;      // The text, rounded exactly in the mode.
+};
+
+static const Parse_Case PARSE_CASES[] = {
+    { "1.23456789123e3",      8, "half_even",   "1234.56789123" },
+    { "-1.23456789123e3",     8, "floor",       "-1234.56789123" },
+    { "9.87654321987654e2",  10, "toward_zero", "987.6543219876" },
+    { "1.2345678499999e-1",   8, "half_up",     "0.12345678" },         // Not 0.12345679, from 1.23456785e-1.
+    { "-1.2345678499999e-1",  8, "half_up",     "-0.12345678" },
+    { "1.5e-8",               8, "half_even",   "0.00000002" },
+    { "2.5e-8",               8, "half_even",   "0.00000002" },
+    { "2.5e-8",               8, "half_up",     "0.00000003" },
+    { "1234567.0e-15",        8, "ceil",        "0.00000001" },
+    { "5.0e3",                8, "half_even",   "5000.0" },
+    { "123.45e25",            8, "half_even",   "1234500000000000000000000000.0" },
+};
+
+static void test_parsing() {
+
+    for (const Parse_Case& c : PARSE_CASES) {
+
+        Decimal_Context_Guard guard(static_cast<Size>(c.scale));
+
+        Decimal::rounding_mode(c.mode);
+
+        Decimal value(c.text);
+
+        check(value == Decimal(c.value) && value.get_scale() == static_cast<Size>(c.scale),
+              "Decimal(" + c.text + ") at scale " + std::to_string(c.scale) + ", " + c.mode
+              + ": " + value.to_string() + ", expected " + c.value);
+    }
+}
+
+/********************************************************************************************/
+//
+//                              Rounding Modes
+//
+/********************************************************************************************/
+
+struct Rounding_Case {
+    Text op;            // A quotient, a product, or else the text of a.
+    Text a;
+    Text b;
+    Text mode;
+    Text value;         // At scale 8, rounded exactly in the mode.
+};
+
+static const Rounding_Case ROUNDING_CASES[] = {
+    { "/", "2.0",           "3.0",          "half_even",   "0.66666667" },
+    { "/", "2.0",           "3.0",          "half_up",     "0.66666667" },
+    { "/", "2.0",           "3.0",          "toward_zero", "0.66666666" },
+    { "/", "2.0",           "3.0",          "ceil",        "0.66666667" },
+    { "/", "-2.0",          "3.0",          "half_even",   "-0.66666667" },
+    { "/", "-2.0",          "3.0",          "half_up",     "-0.66666667" },
+    { "/", "-2.0",          "3.0",          "toward_zero", "-0.66666666" },
+    { "/", "-2.0",          "3.0",          "ceil",        "-0.66666666" },
+    { "/", "1.0",           "200000000.0",  "half_even",   "0.00000000" },
+    { "/", "1.0",           "200000000.0",  "half_up",     "0.00000001" },
+    { "/", "1.0",           "200000000.0",  "toward_zero", "0.00000000" },
+    { "/", "1.0",           "200000000.0",  "ceil",        "0.00000001" },
+    { "/", "-1.0",          "200000000.0",  "half_even",   "0.00000000" },
+    { "/", "-1.0",          "200000000.0",  "half_up",     "-0.00000001" },
+    { "/", "-1.0",          "200000000.0",  "toward_zero", "0.00000000" },
+    { "/", "-1.0",          "200000000.0",  "ceil",        "0.00000000" },
+    { "/", "3.0",           "400000000.0",  "half_even",   "0.00000001" },
+    { "/", "3.0",           "400000000.0",  "half_up",     "0.00000001" },
+    { "/", "3.0",           "400000000.0",  "toward_zero", "0.00000000" },
+    { "/", "3.0",           "400000000.0",  "ceil",        "0.00000001" },
+    { "*", "0.00012345",    "0.00012345",   "half_even",   "0.00000002" },
+    { "*", "0.00012345",    "0.00012345",   "half_up",     "0.00000002" },
+    { "*", "0.00012345",    "0.00012345",   "toward_zero", "0.00000001" },
+    { "*", "0.00012345",    "0.00012345",   "ceil",        "0.00000002" },
+    { "*", "0.00025",       "0.0001",       "half_even",   "0.00000002" },
+    { "*", "0.00025",       "0.0001",       "half_up",     "0.00000003" },
+    { "*", "0.00025",       "0.0001",       "toward_zero", "0.00000002" },
+    { "*", "0.00025",       "0.0001",       "ceil",        "0.00000003" },
+    { "*", "-0.00025",      "0.0001",       "half_even",   "-0.00000002" },
+    { "*", "-0.00025",      "0.0001",       "half_up",     "-0.00000003" },
+    { "*", "-0.00025",      "0.0001",       "toward_zero", "-0.00000002" },
+    { "*", "-0.00025",      "0.0001",       "ceil",        "-0.00000002" },
+    { "*", "0.00015",       "-0.0001",      "half_even",   "-0.00000002" },
+    { "*", "0.00015",       "-0.0001",      "half_up",     "-0.00000002" },
+    { "*", "0.00015",       "-0.0001",      "toward_zero", "-0.00000001" },
+    { "*", "0.00015",       "-0.0001",      "ceil",        "-0.00000001" },
+    { "",  "0.123456785",   "",             "half_even",   "0.12345678" },
+    { "",  "0.123456785",   "",             "half_up",     "0.12345679" },
+    { "",  "0.123456785",   "",             "toward_zero", "0.12345678" },
+    { "",  "0.123456785",   "",             "ceil",        "0.12345679" },
+    { "",  "-0.123456785",  "",             "half_even",   "-0.12345678" },
+    { "",  "-0.123456785",  "",             "half_up",     "-0.12345679" },
+    { "",  "-0.123456785",  "",             "toward_zero", "-0.12345678" },
+    { "",  "-0.123456785",  "",             "ceil",        "-0.12345678" },
+    { "",  "0.123456775",   "",             "half_even",   "0.12345678" },
+    { "",  "0.123456775",   "",             "half_up",     "0.12345678" },
+    { "",  "0.123456775",   "",             "toward_zero", "0.12345677" },
+    { "",  "0.123456775",   "",             "ceil",        "0.12345678" },
+    { "",  "-0.1234567851", "",             "half_even",   "-0.12345679" },
+    { "",  "-0.1234567851", "",             "half_up",     "-0.12345679" },
+    { "",  "-0.1234567851", "",             "toward_zero", "-0.12345678" },
+    { "",  "-0.1234567851", "",             "ceil",        "-0.12345678" },
+};
+
+static void test_rounding_modes() {
+
+    for (const Rounding_Case& c : ROUNDING_CASES) {
+
+        Decimal_Context_Guard guard(8);
+
+        Decimal::rounding_mode(c.mode);
+
+        Decimal value = c.op == "/" ? Decimal(c.a) / Decimal(c.b)
+                      : c.op == "*" ? Decimal(c.a) * Decimal(c.b)
+                      :               Decimal(c.a);
+
+        check(value == Decimal(c.value) && value.get_scale() == 8,
+              c.a + " " + c.op + " " + c.b + " in " + c.mode + ": " + value.to_string() + ", expected " + c.value);
+    }
+}
+
+/********************************************************************************************/
+//
+//                              Limb Kernel Variants
+//
+//        Each variant the processor supports against the portable one, over lengths
+//        that run through the vector bodies and their tails.
+//
+/********************************************************************************************/
+
+static void test_limb_variants() {
+
+    typedef Limb_Variant::W W;
+
+    const std::vector<const Limb_Variant*> variants = limb_variants();
+    const Limb_Variant&                    portable = *variants.front();
+
+    for (const Limb_Variant* v : variants) {
+
+        const Text name = v->name;
+
+        for (Size n = 1; n <= 40; ++n) {
+
+            std::vector<W> a(n), b(n), r(n), p(n);
+
+            for (Size i = 0; i < n; ++i) {
+                a[i] = random_word();
+                b[i] = random_word();
+                r[i] = random_word();
+            }
+
+            auto same = [&](const Text& op, W x, W y) {
+                check(x == y && r == p, name + " " + op + " of " + std::to_string(n) + " words");
+            };
+
+            auto both = [&](auto kernel) {
+                p = r;
+                return std::make_pair(kernel(portable, p.data()), kernel(*v, r.data()));
+            };
+
+            std::pair<W, W> c;
+
+            c = both([&](const Limb_Variant& k, W* t) { return k.add_n(t, a.data(), b.data(), n); });
+            same("add_n", c.first, c.second);
+
+            c = both([&](const Limb_Variant& k, W* t) { return k.sub_n(t, a.data(), b.data(), n); });
+            same("sub_n", c.first, c.second);
+
+            for (W m : { W(0), W(1), ~W(0), static_cast<W>(random_word()) }) {
+
+                c = both([&](const Limb_Variant& k, W* t) { return k.mul_1(t, a.data(), n, m); });
+                same("mul_1", c.first, c.second);
+
+                c = both([&](const Limb_Variant& k, W* t) { return k.addmul_1(t, a.data(), n, m); });
+                same("addmul_1", c.first, c.second);
+
+                c = both([&](const Limb_Variant& k, W* t) { return k.submul_1(t, a.data(), n, m); });
+                same("submul_1", c.first, c.second);
+            }
+
+            for (Size bits = 1; bits < 64; bits += 7) {
+
+                c = both([&](const Limb_Variant& k, W* t) { return k.lshift(t, a.data(), n, bits); });
+                same("lshift by " + std::to_string(bits), c.first, c.second);
+
+                c = both([&](const Limb_Variant& k, W* t) { return k.rshift(t, a.data(), n, bits); });
+                same("rshift by " + std::to_string(bits), c.first, c.second);
+            }
+
+            c = both([&](const Limb_Variant& k, W* t) { k.and_n(t, a.data(), b.data(), n); return W(0); });
+            same("and_n", c.first, c.second);
+
+            c = both([&](const Limb_Variant& k, W* t) { k.or_n(t, a.data(), b.data(), n); return W(0); });
+            same("or_n", c.first, c.second);
+
+            c = both([&](const Limb_Variant& k, W* t) { k.xor_n(t, a.data(), b.data(), n); return W(0); });
+            same("xor_n", c.first, c.second);
+
+            c = both([&](const Limb_Variant& k, W* t) { k.com_n(t, a.data(), n); return W(0); });
+            same("com_n", c.first, c.second);
+        }
+    }
+
+    // And whole numbers built on each variant in turn.
+
+    const Text         active = limb_variant().name;
+    const Whole_Number a      = random_whole(300);
+    const Whole_Number b      = random_whole(140);
+
+    Text expected;
+
+    for (const Limb_Variant* v : variants) {
+
+        use_limb_variant(v->name);
+
+        Text result = (a * b + (a << 77) - (b >> 13)).to_string() + " " + (a / b).to_string() + " " + (a % b).to_string();
+
+        if (v == variants.front()) {
+            expected = result;
+        }
+
+        check(result == expected, Text(v->name) + " whole number arithmetic against portable");
+    }
+
+    use_limb_variant(active);
+}
+
+/********************************************************************************************/
+//
+//                              Long Products
+//
+//        Karatsuba's method from its threshold up, and the thread pool's split past
+//        PARALLEL_MUL_LIMBS, with the pool on and off.  A product is checked modulo a
+//        prime, and by dividing it again.
+//
+/********************************************************************************************/
+
+static std::uint64_t residue(const Whole_Number& a) {
+
+    const Whole_Number::Word P = 4294967291u;                                   // 2^32 - 5
+
+    Whole_Number r = a;
+
+    r %= P;
+
+    return r.to_integral<Whole_Number::Word>();
+}
+
+static void check_product(const Whole_Number& a, const Whole_Number& b, const Whole_Number& c, const Text& what) {
+
+    const std::uint64_t P = 4294967291u;
+
+    Whole_Number q, r;
+
+    c.div_rem(a, q, r);
+
+    check(residue(c) == residue(a) * residue(b) % P && q == b && !r.is(), what);
+}
+
+static void test_long_products() {
+
+    const Size sizes[][2] = { { 32, 32 }, { 33, 200 }, { 300, 301 }, { 1024, 1024 }, { 1100, 2500 }, { 2048, 1500 } };
+
+    Thread_Pool& pool    = Thread_Pool::shared();
+    const Size   workers = pool.size() - 1;
+
+    for (const auto& n : sizes) {
+
+        const Whole_Number a = random_whole(n[0]);
+        const Whole_Number b = random_whole(n[1]);
+
+        const Text what = std::to_string(n[0]) + " by " + std::to_string(n[1]) + " words";
+
+        pool.resize(0);
+
+        Whole_Number alone = a * b;
+
+        check_product(a, b, alone, what + ", the pool off");
+
+        pool.resize(3);
+
+        Whole_Number pooled = a * b;
+
+        check_product(a, b, pooled, what + ", the pool on");
+        check(pooled == alone, what + ", the pool on against off");
+
+        Whole_Number square = a * a;
+
+        check_product(a, a, square, what + ", squared");
+    }
+
+    pool.resize(workers);
+}
+
+/********************************************************************************************/
+//
+//                              Text Conversion
+//
+//        Numbers just either side of RADIX_SPLIT_LIMBS and PARALLEL_RADIX_LIMBS, turned
+//        to text and parsed back, with the pool on and off.  The digits are also checked
+//        modulo a prime, by Horner's rule, apart from the library.
+//
+/********************************************************************************************/
+
+static std::uint64_t text_residue(const Text& digits) {
+
+    const std::uint64_t P = 4294967291u;
+
+    std::uint64_t r = 0;
+
+    for (Char c : digits) {
+
+        if (std::isdigit(static_cast<unsigned char>(c))) {
+            r = (r * 10 + static_cast<std::uint64_t>(c - '0')) % P;
+        }
+    }
+
+    return r;
+}
+
+static void test_text_conversion() {
+
+    const Size sizes[] = { 31, 33, 1023, 1025 };                                // Around 32 and 1024 limbs.
+
+    Thread_Pool& pool    = Thread_Pool::shared();
+    const Size   workers = pool.size() - 1;
+
+    for (Size n : sizes) {
+
+        const Whole_Number a = random_whole(n);
+
+        for (Size threads : { Size(0), Size(3) }) {
+
+            pool.resize(threads);
+
+            const Text what = std::to_string(n) + " words, " + std::to_string(threads) + " workers";
+
+            Text digits = a.to_string();
+            Text heximal = a.to_string(16).substr(2);                           // Past its 0x.
+
+            check(text_residue(digits) == residue(a), what + ", the digits");
+            check(Whole_Number(digits) == a,           what + ", parsed back");
+            check(Whole_Number(heximal, 16) == a,      what + ", parsed back from base 16");
+        }
+    }
+
+    pool.resize(workers);
+}
+
+/********************************************************************************************/
+//
+//                              Streamed Digits
+//
+//        write_digits against to_string, through a stream, a FILE and a mapped file, and
+//        read_digits back, stopping at the first character that is not a digit.
+//
+/********************************************************************************************/
+
+static Text bare(Text digits) {
+
+    digits.erase(std::remove(digits.begin(), digits.end(), ','), digits.end());
+
+    return digits;
+}
+
+static Text file_text(FILE* file) {
+
+    Text text;
+
+    std::rewind(file);
+
+    for (int c = std::fgetc(file); c != EOF; c = std::fgetc(file)) {
+        text += static_cast<Char>(c);
+    }
+
+    return text;
+}
+
+static void test_streamed_digits() {
+
+    for (Size n : { Size(1), Size(33), Size(1025) }) {
+
+        const Whole_Number a    = random_whole(n);
+        const Text         what = std::to_string(n) + " words";
+
+        std::stringstream out;
+
+        a.write_digits(out);
+        out << " ";
+        a.write_digits(out, 16);
+
+        check(out.str() == bare(a.to_string()) + " " + a.to_string(16).substr(2), what + ", written");
+
+        std::stringstream in(out.str());
+
+        Whole_Number b = Whole_Number::read_digits(in);
+        in.get();
+        Whole_Number c = Whole_Number::read_digits(in, 16);
+
+        check(b == a && c == a && in.eof() && !in.bad(), what + ", read back");
+
+        FILE* file = std::tmpfile();
+
+        if (file) {
+
+            a.write_digits(file);
+
+            check(file_text(file) == bare(a.to_string()), what + ", written to a FILE");
+
+            std::fclose(file);
+        }
+
+        const Text path = "apm_tests_digits.txt";
+
+        std::ofstream(path) << bare(a.to_string());
+        {
+            Mapped_File  mapped(path);
+            std::istream mapped_in(&mapped);
+
+            check(mapped.is_open() && Whole_Number::read_digits(mapped_in) == a, what + ", read from a mapped file");
+        }
+        std::remove(path.c_str());
+    }
+
+    {
+        const Integer a = -Integer(random_whole(40));
+
+        std::stringstream io;
+
+        a.write_digits(io);
+
+        check(io.str() == bare(a.to_string()) && Integer::read_digits(io) == a, "a negative integer, written and read back");
+
+        const Decimal d("-1234.5");
+
+        std::stringstream dio;
+
+        d.write_digits(dio);
+
+        check(dio.str() == d.to_string() && Decimal::read_digits(dio) == d, "a decimal, written and read back");
+    }
+
+    {
+        std::istringstream in("-12.50x");
+
+        Decimal d = Decimal::read_digits(in);
+
+        check(d == Decimal("-12.5") && !in.fail() && in.peek() == 'x', "read_digits of -12.50x stops at the x");
+    }
+
+    {
+        std::istringstream w(".5"), i(".5"), d(".5");
+
+        check(!Whole_Number::read_digits(w).is() && w.fail(), "Whole_Number::read_digits of .5 reads 0 and fails");
+        check(!Integer::read_digits(i).is()      && i.fail(), "Integer::read_digits of .5 reads 0 and fails");
+        check(Decimal::read_digits(d).is_zero()  && d.fail(), "Decimal::read_digits of .5 reads 0 and fails");
+    }
+}
+
+/********************************************************************************************/
+//
+//                              Single Word Operands
+//
+//        The Word forms of Whole_Number and the sys_int forms of Integer, at the ends of
+//        their ranges and the most negative sys_int, against the forms taking a number.
+//
+/********************************************************************************************/
+
+static void test_word_operands() {
+
+    typedef Whole_Number::Word Word;
+
+    const Word max_word = std::numeric_limits<Word>::max();
+
+    const Word         words[]  = { 0, 1, 2, max_word - 1, max_word };
+    const Whole_Number wholes[] = { Whole_Number(), Whole_Number(1), Whole_Number(max_word),
+                                    Whole_Number(max_word) + Whole_Number(1), random_whole(3) };
+
+    for (const Whole_Number& a : wholes) {
+
+        for (Word w : words) {
+
+            const Whole_Number b(w);
+            const Text         what = a.to_string() + " and the word " + std::to_string(w);
+
+            Whole_Number x;
+
+            x = a; x += w; check(x == a + b, what + ", +=");
+            x = a; x *= w; check(x == a * b, what + ", *=");
+
+            if (a >= b) {
+                x = a; x -= w; check(x == a - b, what + ", -=");
+            }
+
+            if (w) {
+                x = a; x /= w; check(x == a / b, what + ", /=");
+                x = a; x %= w; check(x == a % b, what + ", %=");
+            }
+
+            check((a == w) == (a == b) && (a != w) == (a != b) &&
+                  (a <  w) == (a <  b) && (a >  w) == (a >  b) &&
+                  (a <= w) == (a <= b) && (a >= w) == (a >= b) &&
+                  a.compare(w) == a.compare(b), what + ", compared");
+        }
+    }
+
+    const sys_int min_int = std::numeric_limits<sys_int>::min();
+    const sys_int max_int = std::numeric_limits<sys_int>::max();
+
+    const sys_int ints[]     = { min_int, min_int + 1, -1, 0, 1, max_int };
+    const Integer integers[] = { Integer(), Integer(1), Integer(-1), Integer(min_int), -Integer(min_int),
+                                 Integer(max_int), -Integer(random_whole(3)) };
+
+    check(Integer(min_int).to_string() == Integer(Text(std::to_string(min_int))).to_string(), "the most negative sys_int");
+
+    for (const Integer& a : integers) {
+
+        for (sys_int v : ints) {
+
+            const Integer b(v);
+            const Text    what = a.to_string() + " and the sys_int " + std::to_string(v);
+
+            Integer x;
+
+            x = a; x += v; check(x == a + b, what + ", +=");
+            x = a; x -= v; check(x == a - b, what + ", -=");
+            x = a; x *= v; check(x == a * b, what + ", *=");
+
+            if (v) {
+                x = a; x /= v; check(x == a / b, what + ", /=");
+                x = a; x %= v; check(x == a % b, what + ", %=");
+            }
+
+            check((a == v) == (a == b) && (a != v) == (a != b) &&
+                  (a <  v) == (a <  b) && (a >  v) == (a >  b) &&
+                  (a <= v) == (a <= b) && (a >= v) == (a >= b) &&
+                  a.compare(v) == a.compare(b), what + ", compared");
+        }
+    }
+}
+
+/********************************************************************************************/
+//
+//                              Prepared Divisors
+//
+//        Divisor's word reciprocal and Barrett's method against the long division, and
+//        by q * d + r = n with r < d.  Dividends one short of a multiple of d leave the
+//        largest remainders, where Barrett's estimate most often needs correcting.
+//
+/********************************************************************************************/
+
+static void check_division(const Divisor& divisor, const Whole_Number& n, const Text& what) {
+
+    const Whole_Number& d = divisor.get_Whole_Number();
+
+    Whole_Number q, r, long_q, long_r;
+
+    divisor.div_rem(n, q, r);
+    n.div_rem(d, long_q, long_r);
+
+    check(q == long_q && r == long_r && q * d + r == n && r < d, what);
+}
+
+static void test_divisors() {
+
+    typedef Whole_Number::Word Word;
+
+    const Word max_word = std::numeric_limits<Word>::max();
+    const Word top_bit  = Word(1) << (sizeof(Word) * 8 - 1);
+
+    const Whole_Number words[] = {
+        Whole_Number(1), Whole_Number(3), Whole_Number(10), Whole_Number(top_bit - 1), Whole_Number(top_bit),
+        Whole_Number(max_word - 1), Whole_Number(max_word), random_whole(1)
+    };
+
+    for (const Whole_Number& w : words) {
+
+        if (!w.is()) {
+            continue;
+        }
+
+        Divisor divisor(w);
+
+        for (Size n : { Size(1), Size(2), Size(7), Size(40) }) {
+
+            const Whole_Number a = random_whole(n);
+            const Text         what = "a word divisor " + w.to_string() + " into " + std::to_string(n) + " words";
+
+            check_division(divisor, a, what);
+            check_division(divisor, a * w + w - Whole_Number(1), what + ", the largest remainder");
+            check_division(divisor, (Whole_Number(1) << (n * sizeof(Word) * 8)) - Whole_Number(1), what + ", all ones");
+        }
+    }
+
+    const Size B = sizeof(Word) * 8;
+    const Size K = Divisor::BARRETT_LIMBS;
+
+    const Whole_Number longs[] = {
+        random_whole(K), random_whole(K + 1), random_whole(2 * K),
+        (Whole_Number(1) << (K * B)) - Whole_Number(1),                            // All ones.
+        Whole_Number(1) << ((K - 1) * B),                                           // A lone top word of 1.
+        (Whole_Number(1) << (K * B - 1)) + Whole_Number(1)                          // The top bit, and 1.
+    };
+
+    for (const Whole_Number& d : longs) {
+
+        Divisor    divisor(d);
+        const Size k    = (d.get_Binary_Register().lead_bit() + B - 1) / B;
+        const Text what = "a divisor of " + std::to_string(k) + " words";
+
+        check_division(divisor, d - Whole_Number(1), what + ", a smaller dividend");
+        check_division(divisor, d,                   what + ", itself");
+
+        for (Size trial = 0; trial < 24; ++trial) {
+
+            const Size         m = 1 + trial * k / 8;
+            const Whole_Number q = random_whole(m);
+
+            check_division(divisor, q * d + d - Whole_Number(1), what + ", the largest remainder");
+            check_division(divisor, q * d + random_whole(k - 1),  what + ", by " + std::to_string(m) + " words");
+        }
+
+        check_division(divisor, (Whole_Number(1) << (2 * k * B)) - Whole_Number(1), what + ", 2k words of all ones");
+        check_division(divisor, random_whole(3 * k + 5),                           what + ", a dividend of 3k + 5 words");
+    }
+}
+
+/********************************************************************************************/
+//
+//                              Short Products
+//
+//        mulhigh_n may fall short of the top words of a * b by one, and mullow_n must
+//        match the low words, on either side of SHORT_PRODUCT_THRESHOLD and for words of
+//        all ones, where the dropped partial products carry most.
+//
+/********************************************************************************************/
+
+static void test_short_products() {
+
+    typedef std::uint64_t W;
+
+    for (Size n : { Size(2), Size(3), Size(17), Size(47), Size(48), Size(49), Size(96), Size(150), Size(301) }) {
+
+        for (Boolean ones : { false, true }) {
+
+            std::vector<W> a(n), b(n), full(2 * n), high(n + 2), low(n), gap(n);
+
+            for (Size i = 0; i < n; ++i) {
+                a[i] = ones ? ~W(0) : random_word();
+                b[i] = ones ? ~W(0) : random_word();
+            }
+
+            mul(full.data(), a.data(), n, b.data(), n);
+            mulhigh_n(high.data(), a.data(), b.data(), n);
+            mullow_n(low.data(), a.data(), b.data(), n);
+
+            // The top n words less those of the short product, which must be 0 or 1.
+            W borrow = sub_n(gap.data(), full.data() + n, high.data() + 2, n);
+
+            Boolean short_by_one = !borrow && gap[0] <= 1;
+
+            for (Size i = 1; i < n; ++i) {
+                short_by_one = short_by_one && gap[i] == 0;
+            }
+
+            const Text what = std::to_string(n) + " words" + (ones ? " of all ones" : "");
+
+            check(short_by_one,                                      "mulhigh_n of " + what);
+            check(std::equal(low.begin(), low.end(), full.begin()), "mullow_n of " + what);
+        }
+    }
+}
+
+/********************************************************************************************/
+//
+//                              Binary Format
+//
+//        Each type encoded and decoded back, several to a buffer, and decodes that must
+//        fail: every truncation of an encoding, another kind, a bad tag or version.
+//
+/********************************************************************************************/
+
+template<typename T>
+static Boolean rejects_truncations(const Binary_Format::Bytes& bytes) {
+
+    for (Size size = 0; size < bytes.size(); ++size) {
+
+        T a;
+
+        if (Binary_Format::decode(bytes.data(), size, a) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void test_binary_format() {
+
+    typedef Binary_Format::Bytes Bytes;
+
+    const Whole_Number wholes[]   = { Whole_Number(), Whole_Number(1), random_whole(5), random_whole(1025) };
+    const Integer      integers[] = { Integer(), Integer(-1), -Integer(random_whole(9)), Integer(random_whole(2)),
+                                      Integer(Integer::POS_INFINITY), Integer(Integer::NEG_INFINITY) };
+
+    Bytes all;
+
+    for (const Whole_Number& a : wholes) {
+
+        Bytes bytes;
+
+        Binary_Format::encode(a, bytes);
+
+        Whole_Number b;
+
+        check(Binary_Format::decode(bytes.data(), bytes.size(), b) == bytes.size() && b == a, "a whole number round trip");
+        check(rejects_truncations<Whole_Number>(bytes), "truncated whole numbers rejected");
+
+        Integer i;
+
+        check(Binary_Format::decode(bytes.data(), bytes.size(), i) == 0, "a whole number decoded as an integer rejected");
+
+        all.insert(all.end(), bytes.begin(), bytes.end());
+    }
+
+    for (const Integer& a : integers) {
+
+        Bytes bytes;
+
+        Binary_Format::encode(a, bytes);
+
+        Integer b;
+
+        check(Binary_Format::decode(bytes.data(), bytes.size(), b) == bytes.size() && b.to_string() == a.to_string(),
+              "an integer round trip, " + a.to_string().substr(0, 20));
+        check(rejects_truncations<Integer>(bytes), "truncated integers rejected");
+
+        Decimal d;
+
+        check(Binary_Format::decode(bytes.data(), bytes.size(), d) == 0, "an integer decoded as a decimal rejected");
+
+        all.insert(all.end(), bytes.begin(), bytes.end());
+    }
+
+    const Rational r("-22/7");
+    const Decimal  d("-12345.678901234567890123");
+
+    {
+        Bytes bytes;
+
+        Binary_Format::encode(r, bytes);
+
+        Rational b;
+
+        check(Binary_Format::decode(bytes.data(), bytes.size(), b) == bytes.size() && b == r, "a rational round trip");
+        check(rejects_truncations<Rational>(bytes), "truncated rationals rejected");
+
+        Integer i;
+
+        check(Binary_Format::decode(bytes.data(), bytes.size(), i) == 0, "a rational decoded as an integer rejected");
+
+        all.insert(all.end(), bytes.begin(), bytes.end());
+    }
+
+    {
+        Bytes bytes;
+
+        Binary_Format::encode(d, bytes);
+
+        Decimal b;
+
+        check(Binary_Format::decode(bytes.data(), bytes.size(), b) == bytes.size() && b == d && b.get_scale() == d.get_scale(),
+              "a decimal round trip");
+        check(rejects_truncations<Decimal>(bytes), "truncated decimals rejected");
+
+        Rational q;
+
+        check(Binary_Format::decode(bytes.data(), bytes.size(), q) == 0, "a decimal decoded as a rational rejected");
+
+        Bytes tag = bytes, version = bytes;
+
+        tag[1]     = 'Q';
+        version[3] = Binary_Format::VERSION + 1;
+
+        check(Binary_Format::decode(tag.data(), tag.size(), b) == 0,         "a bad tag rejected");
+        check(Binary_Format::decode(version.data(), version.size(), b) == 0, "a later version rejected");
+
+        all.insert(all.end(), bytes.begin(), bytes.end());
+    }
+
+    // The encodings in turn from the one buffer, each 8 byte aligned.
+
+    Size at = 0;
+
+    Boolean all_read = true;
+
+    for (const Whole_Number& a : wholes) {
+
+        Whole_Number b;
+        Size         read = Binary_Format::decode(all.data() + at, all.size() - at, b);
+
+        all_read = all_read && read && read % 8 == 0 && b == a;
+        at      += read;
+    }
+
+    for (const Integer& a : integers) {
+
+        Integer b;
+        Size    read = Binary_Format::decode(all.data() + at, all.size() - at, b);
+
+        all_read = all_read && read && read % 8 == 0 && b.to_string() == a.to_string();
+        at      += read;
+    }
+
+    Rational rb;
+    Decimal  db;
+
+    at += Binary_Format::decode(all.data() + at, all.size() - at, rb);
+    at += Binary_Format::decode(all.data() + at, all.size() - at, db);
+
+    check(all_read && rb == r && db == d && at == all.size(), "encodings read in turn from one buffer");
+}
+
+/********************************************************************************************/
+//
+//                              Shared Limbs
+//
+//        A copy of a value of SHARE_LIMBS limbs or more shares its block.  Each way of
+//        writing to one copy must give it its own block, and leave the other as it was.
+//
+/********************************************************************************************/
+
+static void test_shared_limbs() {
+
+    typedef Whole_Number::Word Word;
+
+    typedef void (*Write)(Whole_Number& x);
+
+    const std::pair<Text, Write> writes[] = {
+        { "+=",        [](Whole_Number& x) { x += Whole_Number(1); } },
+        { "+= word",   [](Whole_Number& x) { x += Word(1); } },
+        { "-= word",   [](Whole_Number& x) { x -= Word(1); } },
+        { "*= word",   [](Whole_Number& x) { x *= Word(3); } },
+        { "/= word",   [](Whole_Number& x) { x /= Word(3); } },
+        { "%= word",   [](Whole_Number& x) { x %= Word(3); } },
+        { "++",        [](Whole_Number& x) { ++x; } },
+        { "--",        [](Whole_Number& x) { --x; } },
+        { "<<=",       [](Whole_Number& x) { x <<= 5; } },
+        { ">>=",       [](Whole_Number& x) { x >>= 5; } },
+        { "&=",        [](Whole_Number& x) { x &= Whole_Number(7); } },
+        { "|=",        [](Whole_Number& x) { x |= Whole_Number(1) << x.get_Binary_Register().lead_bit(); } },
+        { "^=",        [](Whole_Number& x) { x ^= Whole_Number(7); } },
+        { "*=",        [](Whole_Number& x) { x *= x; } },
+        { "/=",        [](Whole_Number& x) { x /= Whole_Number(12345); } },
+    };
+
+    for (Size n : { Size(8), Size(64), Size(200) }) {
+
+        const Whole_Number original = random_whole(n);
+        const Text         text     = original.to_string();
+
+        for (const auto& write : writes) {
+
+            const Text what = write.first + " on a copy of " + std::to_string(n) + " words";
+
+            Whole_Number a = original;
+            Whole_Number b = a;
+
+            write.second(b);
+
+            check(a.to_string() == text && b != a, what + ", the first left as it was");
+
+            Whole_Number c = a;
+
+            write.second(a);
+
+            check(c.to_string() == text && a == b, what + ", the copy left as it was");
+        }
+
+        Integer i(original);
+        Integer j = i;
+
+        j *= sys_int(-1);
+
+        check(i.get_Whole_Number().to_string() == text && i.is_positive() && j == -i, "an Integer copy of " + std::to_string(n) + " words");
+    }
+}
+
+int main() {
+
+    test_limb_carries();
+    test_limb_variants();
+    test_long_products();
+    test_short_products();
+    test_divisors();
+    test_text_conversion();
+    test_streamed_digits();
+    test_word_operands();
+    test_binary_format();
+    test_shared_limbs();
+    test_roots();
+    test_powers();
+    test_exact_results();
+    test_parsing();
+    test_rounding_modes();
+
+    std::cout << (failures ? "FAILED: " : "passed, ") << failures << " failures" << std::endl;
+
+    return failures;
+}